@@ -34,6 +34,10 @@ static char cp_default_char[4];
 
 int cs_cur_max;
 
+// Bumped whenever the locale or codepage changes, so that terminals know
+// to discard partial multibyte characters decoded for the old one.
+uint cs_locale_id;
+
 static const struct {
   ushort cp;
   string name;
@@ -263,9 +267,6 @@ update_mode(void)
 #else
   get_cp_info();
 #endif
-
-  // Clear output conversion state.
-  cs_mb1towc(0, 0);
 }
 
 void
@@ -309,6 +310,7 @@ update_locale(void)
   }
 #endif
 
+  cs_locale_id++;
   update_mode();
 }
 
@@ -411,32 +413,32 @@ cs_mbstowcs(wchar *ws, const char *s, size_t wlen)
 }
 
 int
-cs_mb1towc(wchar *pwc, char c)
+cs_mb1towc(cs_mbstate *state, wchar *pwc, char c)
 {
+  if (!pwc) {
+    // Reset state
+    memset(state, 0, sizeof *state);
+    return 0;
+  }
+
 #if HAS_LOCALES
   if (use_locale)
-    return mbrtowc(pwc, &c, 1, 0);
+    return mbrtowc(pwc, &c, 1, &state->mbs);
 #endif
 
   // The Windows way
-  static int sn;
-  static char s[8];
-  static wchar ws[2];
+  char *s = state->s;
+  wchar *ws = state->ws;
 
-  if (!pwc) {
-    // Reset state
-    sn = 0;
-    return 0;
-  }
-  if (sn < 0) {
+  if (state->n < 0) {
     // Leftover surrogate
     *pwc = ws[1];
-    sn = 0;
+    state->n = 0;
     return 1;
   }
-  s[sn++] = c;
-  s[sn] = 0;
-  switch (MultiByteToWideChar(codepage, 0, s, sn, ws, 2)) {
+  s[state->n++] = c;
+  s[state->n] = 0;
+  switch (MultiByteToWideChar(codepage, 0, s, state->n, ws, 2)) {
     when 1: {
       // Incomplete sequences yield the codepage's default character, but so
       // does the default character's very own (valid) sequence.
@@ -447,23 +449,23 @@ cs_mb1towc(wchar *pwc, char c)
         (!*ws && *s);
       if (!incomplete) {
         *pwc = *ws;
-        sn = 0;
+        state->n = 0;
         return 1;
       }
     }
     when 2:
       if (IS_HIGH_SURROGATE(*ws)) {
         *pwc = *ws;
-        sn = -1; // Surrogate pair
+        state->n = -1; // Surrogate pair
         return 0;
       }
       // Special handling for GB18030. Windows considers the first two bytes
       // of a four-byte sequence as an encoding error followed by a digit.
-      if (codepage == 54936 && sn == 2 && ws[1] >= '0' && ws[1] <= '9')
+      if (codepage == 54936 && state->n == 2 && ws[1] >= '0' && ws[1] <= '9')
         return -2;
       return -1; // Encoding error
   }
-  return sn < cs_cur_max ? -2 : -1;
+  return state->n < cs_cur_max ? -2 : -1;
 }
 
 wchar
@@ -40,13 +40,22 @@ void cs_set_mode(cs_mode);
 
 int cs_wcntombn(char *s, const wchar *ws, size_t len, size_t wlen);
 int cs_mbstowcs(wchar *ws, const char *s, size_t wlen);
-int cs_mb1towc(wchar *pwc, char c);
+// State of a conversion from multibyte to wide characters
+typedef struct {
+  mbstate_t mbs;  // when converting via the locale
+  int n;          // otherwise, the bytes of the character so far
+  char s[8];
+  wchar ws[2];
+} cs_mbstate;
+
+int cs_mb1towc(cs_mbstate *, wchar *pwc, char c);
 wchar cs_btowc_glyph(char);
 
 extern string locale_menu[];
 extern string charset_menu[];
 
 extern int cs_cur_max;
+extern uint cs_locale_id;
 
 extern bool font_ambig_wide;
 
@@ -54,7 +63,8 @@ extern bool font_ambig_wide;
 extern bool cs_ambig_wide;
 #else
 #define cs_ambig_wide font_ambig_wide
-int xcwidth(xchar c);
 #endif
 
+int xcwidth(xchar c);
+
 #endif
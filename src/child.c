@@ -13,9 +13,11 @@
 #include <utmp.h>
 #include <dirent.h>
 #include <signal.h>
+#include <spawn.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
 #include <sys/cygwin.h>
+#include <time.h>
 
 #if CYGWIN_VERSION_API_MINOR >= 93
 #include <pty.h>
@@ -43,6 +45,162 @@ error(struct term* term, char *action)
   }
 }
 
+static void
+init_line_settings(int fd)
+{
+  struct termios attr;
+  tcgetattr(fd, &attr);
+  attr.c_cc[VERASE] = cfg.backspace_sends_bs ? CTRL('H') : CDEL;
+  attr.c_iflag |= IXANY | IMAXBEL;
+  attr.c_lflag |= ECHOE | ECHOK | ECHOCTL | ECHOKE;
+  tcsetattr(fd, TCSANOW, &attr);
+}
+
+#if CYGWIN_VERSION_DLL_MAJOR >= 1007 && defined POSIX_SPAWN_SETSID
+
+extern char **environ;
+
+static bool
+is_locale_var(const char *var)
+{
+  static const char *names[] = {
+    "LC_ALL=", "LC_COLLATE=", "LC_CTYPE=", "LC_MONETARY=", "LC_NUMERIC=",
+    "LC_TIME=", "LC_MESSAGES=", "LANG="
+  };
+  for (uint i = 0; i < lengthof(names); i++) {
+    if (!strncmp(var, names[i], strlen(names[i])))
+      return true;
+  }
+  return false;
+}
+
+/*
+ * Start the child with posix_spawn() instead of fork(), which on Cygwin
+ * has to copy the whole address space, scrollback and all. The child
+ * gets the same setup as in the forkpty() path in child_create():
+ * its own session with the pty as controlling terminal, default signal
+ * handlers except for the job control ones, TERM and locale.
+ * Returns the pid, or -1 if anything fails, in which case the caller
+ * falls back to forkpty().
+ */
+static pid_t
+spawn_child(struct child* child, char *argv[], struct winsize *winp,
+            const char *path, string lang)
+{
+#if CYGWIN_VERSION_DLL_MAJOR < 3004
+  // Without posix_spawn_file_actions_addchdir_np(), the only way to start
+  // the child elsewhere would be to change our own directory for the
+  // duration, which the log writer thread would see.
+  if (path)
+    return -1;
+#endif
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0)
+    return -1;
+  char *slave_name;
+  if (grantpt(master) < 0 || unlockpt(master) < 0 ||
+      !(slave_name = ptsname(master))) {
+    close(master);
+    return -1;
+  }
+  fcntl(master, F_SETFD, FD_CLOEXEC);
+  ioctl(master, TIOCSWINSZ, winp);
+
+  // Keep the slave open until the child has it, so the line settings
+  // stick.
+  int slave = open(slave_name, O_RDWR | O_NOCTTY | O_CLOEXEC);
+  if (slave < 0) {
+    close(master);
+    return -1;
+  }
+  init_line_settings(slave);
+
+  // Environment
+  uint n = 0;
+  while (environ[n])
+    n++;
+  char **envp = newn(char *, n + 3);
+  char *term_var = asform("TERM=%s", cfg.term);
+  char *lang_var = lang ? asform("LANG=%s", lang) : 0;
+  uint envc = 0;
+  for (uint i = 0; i < n; i++) {
+    if (strncmp(environ[i], "TERM=", 5) && !(lang && is_locale_var(environ[i])))
+      envp[envc++] = environ[i];
+  }
+  envp[envc++] = term_var;
+  if (lang_var)
+    envp[envc++] = lang_var;
+  envp[envc] = 0;
+
+  // Opening the slave after setsid() makes it the controlling terminal.
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 0, slave_name, O_RDWR, 0);
+  posix_spawn_file_actions_adddup2(&actions, 0, 1);
+  posix_spawn_file_actions_adddup2(&actions, 0, 2);
+#if CYGWIN_VERSION_DLL_MAJOR >= 3004
+  // If that fails, so does the spawn, and forkpty() gets to try.
+  if (path)
+    posix_spawn_file_actions_addchdir_np(&actions, path);
+#endif
+
+  posix_spawnattr_t attr;
+  posix_spawnattr_init(&attr);
+  sigset_t sigs;
+  sigemptyset(&sigs);
+  posix_spawnattr_setsigmask(&attr, &sigs);
+  sigaddset(&sigs, SIGHUP);
+  sigaddset(&sigs, SIGINT);
+  sigaddset(&sigs, SIGQUIT);
+  sigaddset(&sigs, SIGTERM);
+  sigaddset(&sigs, SIGCHLD);
+  posix_spawnattr_setsigdefault(&attr, &sigs);
+  posix_spawnattr_setflags(&attr,
+    POSIX_SPAWN_SETSID | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK);
+
+  // Mimick login's behavior by disabling the job control signals.
+  // Ignored signals stay ignored across exec, so ignore them here for
+  // the duration. Unlike the working directory, this doesn't affect the
+  // log writer thread, which has nothing to do with these signals.
+  static const int job_sigs[] = {SIGTSTP, SIGTTIN, SIGTTOU};
+  struct sigaction ign = {.sa_handler = SIG_IGN}, old_sa[lengthof(job_sigs)];
+  for (uint i = 0; i < lengthof(job_sigs); i++)
+    sigaction(job_sigs[i], &ign, &old_sa[i]);
+
+  pid_t pid;
+  int err = posix_spawnp(&pid, child->cmd, &actions, &attr, argv, envp);
+
+  for (uint i = 0; i < lengthof(job_sigs); i++)
+    sigaction(job_sigs[i], &old_sa[i], 0);
+
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+  free(envp);
+  free(term_var);
+  free(lang_var);
+  close(slave);
+
+  if (err) {
+    close(master);
+    return -1;
+  }
+  child->pty_fd = master;
+  return pid;
+}
+
+#else
+
+static pid_t
+spawn_child(struct child* child, char *argv[], struct winsize *winp,
+            const char *path, string lang)
+{
+  (void)child, (void)argv, (void)winp, (void)path, (void)lang;
+  return -1;
+}
+
+#endif
+
 void
 child_create(struct child* child, struct term* term,
     char *argv[], struct winsize *winp, const char* path)
@@ -54,10 +212,15 @@ child_create(struct child* child, struct term* term,
 
   string lang = cs_lang();
 
-  // Create the child process and pseudo terminal.
-  pid = forkpty(&child->pty_fd, 0, 0, winp);
+  // Create the child process and pseudo terminal, without forking
+  // if possible.
+  pid = spawn_child(child, argv, winp, path, lang);
+  if (pid < 0)
+    pid = forkpty(&child->pty_fd, 0, 0, winp);
   if (pid < 0) {
     child->pid = pid = 0;
+    if (!term)  // spare shell, see child_fill_pool()
+      return;
     bool rebase_prompt = (errno == EAGAIN);
     error(term, "fork child process");
     if (rebase_prompt) {
@@ -118,12 +281,7 @@ child_create(struct child* child, struct term* term,
     }
 
     // Terminal line settings
-    struct termios attr;
-    tcgetattr(0, &attr);
-    attr.c_cc[VERASE] = cfg.backspace_sends_bs ? CTRL('H') : CDEL;
-    attr.c_iflag |= IXANY | IMAXBEL;
-    attr.c_lflag |= ECHOE | ECHOK | ECHOCTL | ECHOKE;
-    tcsetattr(0, TCSANOW, &attr);
+    init_line_settings(0);
 
     if (path)
       chdir(path);
@@ -177,9 +335,16 @@ child_create(struct child* child, struct term* term,
 void
 child_free(struct child* child)
 {
+  child_log_close(child);
   if (child->pty_fd >= 0)
     close(child->pty_fd);
   child->pty_fd = -1;
+  free(child->outbuf);
+  child->outbuf = 0;
+  child->out_pos = child->out_len = child->out_size = 0;
+  free(child->ring);
+  child->ring = 0;
+  child->ring_start = child->ring_len = child->ring_size = 0;
 }
 
 bool
@@ -188,15 +353,37 @@ child_is_alive(struct child* child)
     return child->pid;
 }
 
-bool
-child_is_parent(struct child* child)
+/*
+ * Snapshot of which processes have children, taken in a single pass
+ * over /proc and reused for a while, as checking every tab means
+ * checking every process for each of them.
+ */
+enum { PROC_SNAPSHOT_TTL_MS = 500 };
+static pid_t *proc_parents;  // sorted
+static uint proc_parents_len, proc_parents_size;
+static long long proc_snapshot_ms = -1;
+
+static int
+cmp_pid(const void *a, const void *b)
 {
-  if (!child->pid)
-    return false;
+  pid_t p = *(const pid_t *)a, q = *(const pid_t *)b;
+  return (p > q) - (p < q);
+}
+
+static void
+update_proc_snapshot(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  long long now = ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+  if (proc_snapshot_ms >= 0 && now - proc_snapshot_ms < PROC_SNAPSHOT_TTL_MS)
+    return;
+  proc_snapshot_ms = now;
+  proc_parents_len = 0;
+
   DIR *d = opendir("/proc");
   if (!d)
-    return false;
-  bool res = false;
+    return;
   struct dirent *e;
   char fn[280] = "/proc/";
   while ((e = readdir(d))) {
@@ -209,21 +396,116 @@ child_is_parent(struct child* child)
       pid_t ppid = 0;
       fscanf(f, "%u", &ppid);
       fclose(f);
-      if (ppid == child->pid) {
-        res = true;
-        break;
+      if (ppid <= 1)
+        continue;
+      if (proc_parents_len == proc_parents_size) {
+        proc_parents_size = proc_parents_size * 2 ?: 256;
+        proc_parents = renewn(proc_parents, proc_parents_size);
       }
+      proc_parents[proc_parents_len++] = ppid;
     }
   }
   closedir(d);
-  return res;
+  qsort(proc_parents, proc_parents_len, sizeof *proc_parents, cmp_pid);
+}
+
+bool
+child_is_parent(struct child* child)
+{
+  if (!child->pid)
+    return false;
+  update_proc_snapshot();
+  return bsearch(&child->pid, proc_parents, proc_parents_len,
+                 sizeof *proc_parents, cmp_pid);
+}
+
+/*
+ * Whatever the pty doesn't take straight away is queued, and written
+ * out by the child loop when the pty becomes writable again, so that
+ * keystrokes and reports don't get lost when the child is slow to read.
+ * Bulk producers such as pasting hold back while anything is queued.
+ */
+
+// Queue size above which optional output such as mouse motion is dropped
+enum { CHILD_OUT_HIGH = 64 * 1024 };
+
+static void
+queue_output(struct child* child, const char *buf, uint len)
+{
+  if (child->out_pos && child->out_len + len > child->out_size) {
+    child->out_len -= child->out_pos;
+    memmove(child->outbuf, child->outbuf + child->out_pos, child->out_len);
+    child->out_pos = 0;
+  }
+  if (child->out_len + len > child->out_size) {
+    child->out_size = max(max(child->out_size * 2, child->out_len + len), 4096);
+    child->outbuf = renewn(child->outbuf, child->out_size);
+  }
+  memcpy(child->outbuf + child->out_len, buf, len);
+  child->out_len += len;
+}
+
+/* Write out as much of the queue as the pty takes without blocking. */
+void
+child_flush(struct child* child)
+{
+  if (child->pty_fd < 0) {
+    child->out_pos = child->out_len = 0;
+    return;
+  }
+  while (child->out_pos < child->out_len) {
+    int n = write(child->pty_fd, child->outbuf + child->out_pos,
+                  child->out_len - child->out_pos);
+    if (n > 0)
+      child->out_pos += n;
+    else if (n < 0 && errno == EINTR)
+      continue;
+    else
+      break;
+  }
+  if (child->out_pos == child->out_len)
+    child->out_pos = child->out_len = 0;
+}
+
+bool
+child_is_congested(struct child* child)
+{
+  return child->out_len - child->out_pos >= CHILD_OUT_HIGH;
 }
 
 void
 child_write(struct child* child, const char *buf, uint len)
 {
-  if (child->pty_fd >= 0)
-    write(child->pty_fd, buf, len);
+  if (child->pty_fd < 0)
+    return;
+  if (child->out_pos == child->out_len) {
+    int n = write(child->pty_fd, buf, len);
+    if (n > 0) {
+      buf += n;
+      len -= n;
+    }
+  }
+  if (len)
+    queue_output(child, buf, len);
+}
+
+/*
+ * Write as much as the pty takes without blocking, but nothing while
+ * output is queued. Returns the number of bytes written, or -1 if the
+ * pty is gone.
+ */
+int
+child_write_some(struct child* child, const char *buf, uint len)
+{
+  if (child->pty_fd < 0)
+    return -1;
+  child_flush(child);
+  if (child->out_len)
+    return 0;
+  int n = write(child->pty_fd, buf, len);
+  if (n < 0 && (errno == EAGAIN || errno == EINTR))
+    return 0;
+  return n;
 }
 
 void
@@ -236,7 +518,7 @@ child_printf(struct child* child, const char *fmt, ...)
     int len = vasprintf(&s, fmt, va);
     va_end(va);
     if (len >= 0)
-      write(child->pty_fd, s, len);
+      child_write(child, s, len);
     free(s);
   }
 }
@@ -245,6 +527,7 @@ void
 child_send(struct child* child, const char *buf, uint len)
 {
   term_reset_screen(child->term);
+  term_keystroke(child->term);
   if (child->term->echoing)
     term_write(child->term, buf, len);
   child_write(child, buf, len);
@@ -253,10 +536,20 @@ child_send(struct child* child, const char *buf, uint len)
 void
 child_sendw(struct child* child, const wchar *ws, uint wlen)
 {
-  char s[wlen * cs_cur_max];
-  int len = cs_wcntombn(s, ws, sizeof s, wlen);
-  if (len > 0)
-    child_send(child, s, len);
+  term_update_cs(child->term);
+
+  // Convert in pieces, so that long strings can't blow the stack.
+  while (wlen) {
+    uint n = min(wlen, 256);
+    if (n < wlen && is_high_surrogate(ws[n - 1]))
+      n--;
+    char s[n * cs_cur_max];
+    int len = cs_wcntombn(s, ws, sizeof s, n);
+    if (len > 0)
+      child_send(child, s, len);
+    ws += n;
+    wlen -= n;
+  }
 }
 
 void
@@ -266,6 +559,31 @@ child_resize(struct child* child, struct winsize *winp)
     ioctl(child->pty_fd, TIOCSWINSZ, winp);
 }
 
+/*
+ * Working directory of the pty's foreground process, if any, or else of
+ * the child process. Returns null if it can't be found out.
+ */
+char *
+child_get_cwd(struct child* child)
+{
+#if CYGWIN_VERSION_DLL_MAJOR >= 1005
+  // Finding the working directory requires the /proc filesystem, which
+  // isn't available before Cygwin 1.5.
+  int fg_pid = (child->pty_fd >= 0) ? tcgetpgrp(child->pty_fd) : 0;
+  if (fg_pid <= 0)
+    fg_pid = child->pid;
+
+  if (fg_pid > 0) {
+    char proc_cwd[32];
+    sprintf(proc_cwd, "/proc/%u/cwd", fg_pid);
+    return realpath(proc_cwd, 0);
+  }
+#else
+  (void)child;
+#endif
+  return 0;
+}
+
 wstring
 child_conv_path(struct child* child, wstring wpath)
 {
@@ -301,21 +619,8 @@ child_conv_path(struct child* child, wstring wpath)
   }
   else if (*path != '/') {
 #if CYGWIN_VERSION_DLL_MAJOR >= 1005
-    // Handle relative paths. Finding the foreground process working directory
-    // requires the /proc filesystem, which isn't available before Cygwin 1.5.
-
-    // Find pty's foreground process, if any. Fall back to child process.
-    int fg_pid = (child->pty_fd >= 0) ? tcgetpgrp(child->pty_fd) : 0;
-    if (fg_pid <= 0)
-      fg_pid = child->pid;
-
-    char *cwd = 0;
-    if (fg_pid > 0) {
-      char proc_cwd[32];
-      sprintf(proc_cwd, "/proc/%u/cwd", fg_pid);
-      cwd = realpath(proc_cwd, 0);
-    }
-
+    // Handle relative paths, relative to the foreground process.
+    char *cwd = child_get_cwd(child);
     exp_path = asform("%s/%s", cwd ?: child->home, path);
     free(cwd);
 #else
@@ -366,8 +671,6 @@ child_fork(struct child* child, int argc, char *argv[])
   if (fork() == 0) {
     if (child->pty_fd >= 0)
       close(child->pty_fd);
-    if (child_log_fd >= 0)
-      close(child_log_fd);
     close(child_win_fd);
 
     (void)argc;
@@ -11,32 +11,63 @@ struct child
 
   pid_t pid;
   bool killed;
+  bool exited;  // reaped
+  uint log_id;  // tab number in the log, or 0 if nothing logged yet
   int pty_fd;
   struct term* term;
+
+  // Output the pty hasn't taken yet
+  char *outbuf;
+  uint out_pos, out_len, out_size;
+
+  // Ring buffer of input from the pty not yet processed by the terminal
+  char *ring;
+  uint ring_start, ring_len, ring_size;
+  long long ring_used_us;  // when input was last read into it
+
+  // Parsing time slices, for diagnostics
+  uint slices;                        // slices used
+  uint slices_exhausted;              // slices that ran out of time
+  unsigned long long slice_us;        // time spent parsing
+  unsigned long long bytes_parsed;
 };
 
 void child_create(struct child* child, struct term* term,
     char *argv[], struct winsize *winp, const char* path);
 void child_free(struct child* child);
+bool child_create_spare(struct child* child, struct term* term,
+    struct winsize *winp, const char* path);
+void child_fill_pool(char *cmd, char *argv[], struct winsize *winp,
+    const char* path);
 void child_proc();
+void child_wake();
 void child_kill();
 void child_terminate(struct child* child);
 void child_write(struct child* child, const char *, unsigned int len);
+int child_write_some(struct child* child, const char *, unsigned int len);
+void child_flush(struct child* child);
+bool child_is_congested(struct child* child);
 void child_printf(struct child* child, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 void child_send(struct child* child, const char *, uint len);
 void child_sendw(struct child* child, const wchar *, uint len);
 void child_resize(struct child* child, struct winsize *winp);
+void child_release_ring(struct child* child);
 bool child_is_alive(struct child* child);
 bool child_is_parent(struct child* child);
 bool child_is_any_parent();
+char *child_get_cwd(struct child*);
 wstring child_conv_path(struct child*, wstring);
 void child_fork(struct child* child, int argc, char *argv[]);
 
 void child_onexit(int sig);
 void child_init();
 
+void child_log_init(void);
+void child_log(struct child* child, const char *, uint len);
+void child_log_close(struct child* child);
+void child_log_flush(void);
+
 extern int child_win_fd;
-extern int child_log_fd;
 
 
 #endif
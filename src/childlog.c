@@ -0,0 +1,351 @@
+// childlog.c (part of FaTTY)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+#include "child.h"
+
+#include "config.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <time.h>
+
+/*
+ * Session logging. Output is copied into an in-memory ring by the child
+ * loop and written out by a thread of its own, so that a slow disk or
+ * network share can't hold up the terminal. If the writer can't keep up
+ * and the ring fills, output is dropped rather than waited for, and the
+ * log says how much.
+ *
+ * If the log file name contains "%d", each tab gets a file of its own,
+ * with the tab's number in its place. Otherwise all tabs share one file.
+ * With LogMaxSize set, a file that grows beyond that many megabytes is
+ * renamed with a ".1" suffix, replacing any previous one, and started
+ * afresh. With LogHeaders set, a line saying which tab and when is
+ * written whenever the output switches tabs or a second has passed.
+ *
+ * The settings are taken when logging starts, so that the writer needn't
+ * look at the config, which the options dialog may change at any time.
+ * The log file name is made absolute then, too.
+ *
+ * Requests to close a tab's file are passed separately from the ring, so
+ * that they can't be dropped along with output, which would leave the
+ * file open.
+ *
+ * At exit, the writer is given a couple of seconds to finish, so that a
+ * hung log destination can't keep us from exiting.
+ */
+
+enum { LOG_RING_SIZE = 4 << 20, LOG_FLUSH_SECS = 2 };
+
+typedef struct {
+  uint id;             // tab number
+  uint len;            // data following
+  struct timeval time;
+} log_record;
+
+typedef struct {
+  uint id;             // tab number, or 0 for the shared file
+  int fd;
+  unsigned long long size;
+  char *name;
+  uint last_id;        // tab of the last header
+  time_t last_time;    // second of the last header
+} log_file;
+
+static pthread_t writer;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static char *ring;
+static uint ring_start, ring_len;
+static uint *closing;  // tabs whose files are to be closed
+static uint closing_len;
+static unsigned long long dropped;
+static bool stopping, finished;
+static bool logging;
+static uint last_id;
+
+static char *log_name;
+static int log_max_size;
+static bool log_headers;
+
+// Only touched by the writer thread.
+static log_file *files;
+static uint files_len;
+
+static void
+ring_put(const void *data, uint len)
+{
+  uint end = (ring_start + ring_len) % LOG_RING_SIZE;
+  uint first = min(len, LOG_RING_SIZE - end);
+  memcpy(ring + end, data, first);
+  memcpy(ring, (const char *)data + first, len - first);
+  ring_len += len;
+}
+
+static void
+queue(uint id, const char *data, uint len)
+{
+  log_record rec = {.id = id, .len = len};
+  gettimeofday(&rec.time, 0);
+  pthread_mutex_lock(&lock);
+  if (ring_len + sizeof rec + len > LOG_RING_SIZE)
+    dropped += len;
+  else {
+    ring_put(&rec, sizeof rec);
+    ring_put(data, len);
+    pthread_cond_signal(&cond);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+static void
+queue_close(uint id)
+{
+  pthread_mutex_lock(&lock);
+  closing = renewn(closing, closing_len + 1);
+  closing[closing_len++] = id;
+  pthread_cond_signal(&cond);
+  pthread_mutex_unlock(&lock);
+}
+
+static bool
+per_tab(void)
+{
+  return strstr(log_name, "%d");
+}
+
+static char *
+file_name(uint id)
+{
+  if (!id)
+    return strdup(log_name);
+  const char *p = strstr(log_name, "%d");
+  return asform("%.*s%u%s", (int)(p - log_name), log_name, id, p + 2);
+}
+
+static int
+open_log(const char *name)
+{
+  if (!strcmp(name, "-"))
+    return dup(1);
+  return open(name, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+}
+
+static log_file *
+find_file(uint id)
+{
+  if (!per_tab())
+    id = 0;
+  for (uint i = 0; i < files_len; i++) {
+    if (files[i].id == id)
+      return &files[i];
+  }
+  // Files that can't be opened are remembered too, to only complain once.
+  char *name = file_name(id);
+  int fd = open_log(name);
+  if (fd < 0)
+    fprintf(stderr, "Opening log file %s failed\n", name);
+  files = renewn(files, files_len + 1);
+  log_file *f = &files[files_len++];
+  *f = (log_file){.id = id, .fd = fd, .name = name};
+  return f;
+}
+
+static void
+close_file(uint id)
+{
+  for (uint i = 0; i < files_len; i++) {
+    if (files[i].id == id) {
+      if (files[i].fd >= 0)
+        close(files[i].fd);
+      free(files[i].name);
+      files[i] = files[--files_len];
+      return;
+    }
+  }
+}
+
+static void
+write_all(log_file *f, const char *data, uint len)
+{
+  while (len) {
+    int n = write(f->fd, data, len);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+    data += n;
+    len -= n;
+    f->size += n;
+  }
+}
+
+static void
+rotate(log_file *f)
+{
+  if (!log_max_size || f->size < (unsigned long long)log_max_size << 20)
+    return;
+  if (!strcmp(f->name, "-"))
+    return;
+  char *old = asform("%s.1", f->name);
+  close(f->fd);
+  rename(f->name, old);
+  free(old);
+  f->fd = open_log(f->name);
+  f->size = 0;
+  f->last_id = 0;
+}
+
+static void
+write_record(log_record *rec, const char *data)
+{
+  log_file *f = find_file(rec->id);
+  if (f->fd < 0)
+    return;
+  if (log_headers &&
+      (rec->id != f->last_id || rec->time.tv_sec != f->last_time)) {
+    struct tm tm;
+    localtime_r(&rec->time.tv_sec, &tm);
+    char header[64];
+    int len = snprintf(header, sizeof header,
+                       "\r\n[tab %u %04d-%02d-%02d %02d:%02d:%02d.%03ld]\r\n",
+                       rec->id, tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                       tm.tm_hour, tm.tm_min, tm.tm_sec,
+                       (long)rec->time.tv_usec / 1000);
+    write_all(f, header, len);
+    f->last_id = rec->id;
+    f->last_time = rec->time.tv_sec;
+  }
+  write_all(f, data, rec->len);
+  rotate(f);
+}
+
+static void *
+write_log(void *unused(arg))
+{
+  char *buf = malloc(LOG_RING_SIZE);
+  for (;;) {
+    pthread_mutex_lock(&lock);
+    while (!ring_len && !closing_len && !stopping)
+      pthread_cond_wait(&cond, &lock);
+    if (!ring_len && !closing_len) {
+      pthread_mutex_unlock(&lock);
+      break;
+    }
+    // Take everything queued, so the lock is held only for the copy.
+    uint len = ring_len;
+    uint first = min(len, LOG_RING_SIZE - ring_start);
+    memcpy(buf, ring + ring_start, first);
+    memcpy(buf + first, ring, len - first);
+    ring_start = (ring_start + len) % LOG_RING_SIZE;
+    ring_len = 0;
+    unsigned long long lost = dropped;
+    dropped = 0;
+    uint *closes = closing, closes_len = closing_len;
+    closing = 0;
+    closing_len = 0;
+    pthread_mutex_unlock(&lock);
+
+    for (uint pos = 0; pos < len;) {
+      log_record rec;
+      memcpy(&rec, buf + pos, sizeof rec);
+      pos += sizeof rec;
+      write_record(&rec, buf + pos);
+      pos += rec.len;
+    }
+    // Closed tabs' output has all been taken along with the above.
+    if (per_tab()) {
+      for (uint i = 0; i < closes_len; i++)
+        close_file(closes[i]);
+    }
+    free(closes);
+    if (lost) {
+      char msg[64];
+      int n = snprintf(msg, sizeof msg,
+                       "\r\n[log: %llu bytes dropped]\r\n", lost);
+      for (uint i = 0; i < files_len; i++) {
+        if (files[i].fd >= 0)
+          write_all(&files[i], msg, n);
+      }
+    }
+  }
+  for (uint i = 0; i < files_len; i++) {
+    if (files[i].fd >= 0)
+      close(files[i].fd);
+  }
+  free(buf);
+  pthread_mutex_lock(&lock);
+  finished = true;
+  pthread_cond_signal(&done_cond);
+  pthread_mutex_unlock(&lock);
+  return 0;
+}
+
+void
+child_log_init(void)
+{
+  if (!*cfg.log)
+    return;
+  if (*cfg.log == '/' || !strcmp(cfg.log, "-"))
+    log_name = strdup(cfg.log);
+  else {
+    char *cwd = getcwd(0, 0);
+    log_name = asform("%s/%s", cwd ? cwd : ".", cfg.log);
+    free(cwd);
+  }
+  log_max_size = cfg.log_max_size;
+  log_headers = cfg.log_headers;
+  ring = malloc(LOG_RING_SIZE);
+  if (pthread_create(&writer, 0, write_log, 0)) {
+    fputs("Starting log writer failed\n", stderr);
+    free(ring);
+    return;
+  }
+  logging = true;
+  atexit(child_log_flush);
+}
+
+/*
+ * Write out everything queued and stop the writer, waiting for it for
+ * LOG_FLUSH_SECS at most. Not for calling from a signal handler.
+ */
+void
+child_log_flush(void)
+{
+  if (!logging)
+    return;
+  logging = false;
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += LOG_FLUSH_SECS;
+  pthread_mutex_lock(&lock);
+  stopping = true;
+  pthread_cond_signal(&cond);
+  while (!finished &&
+         pthread_cond_timedwait(&done_cond, &lock, &deadline) != ETIMEDOUT);
+  bool done = finished;
+  pthread_mutex_unlock(&lock);
+  if (done)
+    pthread_join(writer, 0);
+}
+
+void
+child_log(struct child* child, const char *data, uint len)
+{
+  if (!logging || !len)
+    return;
+  if (!child->log_id)
+    child->log_id = ++last_id;
+  queue(child->log_id, data, len);
+}
+
+void
+child_log_close(struct child* child)
+{
+  if (logging && child->log_id)
+    queue_close(child->log_id);
+  child->log_id = 0;
+}
@@ -3,6 +3,7 @@
 #include <cstdlib>
 #include <stdio.h>
 #include <algorithm>
+#include <vector>
 
 #include <sys/cygwin.h>
 #include <unistd.h>
@@ -13,24 +14,93 @@
 #include <utmp.h>
 #include <dirent.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <time.h>
+
+#include "trace.h"
 
 int child_win_fd;
-int child_log_fd = -1;
+
+// Self-pipe for waking up the child loop, from signal handlers and the like.
+static int wake_fds[2] = {-1, -1};
 
 extern "C" {
 #include "child.h"
+#include "win.h"
+
+// Shells started ahead of time for new tabs, and the directory each was
+// started in.
+struct Spare {
+    struct child chld;
+    std::string cwd;
+};
+static std::vector<Spare> spares;
+
+// Where a child started in the given directory, or in the current one if
+// that's null, ends up.
+static std::string spare_dir(const char* path) {
+    char* dir = realpath(path ? path : ".", 0);
+    std::string result = dir ? dir : "";
+    free(dir);
+    return result;
+}
+
+static void kill_spare(Spare& spare) {
+    kill(-spare.chld.pid, SIGHUP);
+    child_free(&spare.chld);
+}
 
 void child_onexit(int sig) {
     for (auto& tab : win_tabs()) {
         if (tab.chld->pid)
             kill(-tab.chld->pid, SIGHUP);
     }
+    for (auto& spare : spares)
+        kill(-spare.chld.pid, SIGHUP);
+    // Exiting through the signal skips atexit() handlers.
+    child_log_flush();
     signal(sig, SIG_DFL);
     kill(getpid(), sig);
 }
 
+// The terminating signals are handled by the child loop, outside the
+// signal handler, as the log needs flushing. If that doesn't happen,
+// a second signal goes straight through.
+static volatile sig_atomic_t exit_signal;
+
 static void sigexit(int sig) {
-    child_onexit(sig);
+    if (exit_signal) {
+        signal(sig, SIG_DFL);
+        raise(sig);
+    }
+    exit_signal = sig;
+    child_wake();
+}
+
+// Children that have exited are reaped by the child loop, which the
+// signal handler wakes up.
+static volatile sig_atomic_t sigchld_pending;
+
+static void sigchld(int) {
+    sigchld_pending = 1;
+    child_wake();
+}
+
+static void reap_children() {
+    sigchld_pending = 0;
+    pid_t pid;
+    int status;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        for (Tab& tab : win_tabs()) {
+            if (tab.chld->pid == pid)
+                tab.chld->exited = true;
+        }
+        for (Spare& spare : spares) {
+            if (spare.chld.pid == pid)
+                spare.chld.exited = true;
+        }
+    }
 }
 
 void child_init() {
@@ -43,80 +113,251 @@ void child_init() {
 
     child_win_fd = open("/dev/windows", O_RDONLY);
 
-    // Open log file if any
-    if (*cfg.log) {
-        if (!strcmp(cfg.log, "-"))
-            child_log_fd = 1;
-        else {
-            child_log_fd = open(cfg.log, O_WRONLY | O_CREAT | O_TRUNC, 0600);
-            if (child_log_fd < 0)
-                fputs("Opening log file failed\n", stderr);
+    if (pipe(wake_fds) == 0) {
+        for (int fd : wake_fds) {
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = sigchld;
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &sa, nullptr);
+
+    child_log_init();
+    trace_init();
+}
+
+// Pty input is read into a ring buffer per child, for as long as there
+// is any, up to a budget per pass, and then handed to the terminal and
+// the log straight out of the ring. The ring grows when a pass fills it,
+// and is freed once it's been empty for a while, or when the terminal
+// hibernates, so a burst of output doesn't leave a tab holding on to it.
+//
+// Parsing is time-sliced: each pass of the child loop gives every tab
+// with input a slice in turn, starting from a different tab each time,
+// and returns to the message loop as soon as there's a message. Input
+// that doesn't get parsed in its slice stays in the ring for the next
+// pass. That way neither a flood of output nor the UI starves the other,
+// and one busy tab can't hold up the rest.
+static const uint ring_min_size = 64 * 1024;
+static const uint ring_max_size = 1024 * 1024;
+static const uint read_budget = 256 * 1024;
+static const uint parse_chunk = 4096;
+static const long long slice_us = 3000;
+static const long long pass_us = 12000;
+static const long long ring_idle_us = 1000000;
+
+static uint next_tab;  // where the next pass starts
+
+// What the child loop waits for: the window's message queue, the wake-up
+// pipe and the ptys, in that order. The fds are kept between passes to
+// save allocations. poll() rather than select(), as the number of tabs
+// isn't limited by FD_SETSIZE.
+enum { POLL_WIN, POLL_WAKE, POLL_TABS };
+static std::vector<struct pollfd> pollfds;
+
+static long long now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static void grow_ring(struct child* child) {
+    uint size = child->ring_size ? child->ring_size * 2 : ring_min_size;
+    char* ring = (char*)malloc(size);
+    uint first = std::min(child->ring_len, child->ring_size - child->ring_start);
+    if (child->ring_len) {
+        memcpy(ring, child->ring + child->ring_start, first);
+        memcpy(ring + first, child->ring, child->ring_len - first);
+    }
+    free(child->ring);
+    child->ring = ring;
+    child->ring_size = size;
+    child->ring_start = 0;
+}
+
+void child_release_ring(struct child* child) {
+    if (child->ring_len)
+        return;
+    free(child->ring);
+    child->ring = 0;
+    child->ring_start = child->ring_size = 0;
+}
+
+// Read what's available. Returns false if the pty has been closed.
+static bool fill_ring(struct child* child) {
+    trace_scope("read");
+    child->ring_used_us = now_us();
+    for (uint budget = read_budget; budget;) {
+        if (child->ring_len == child->ring_size) {
+            if (child->ring_size >= ring_max_size) break;
+            grow_ring(child);
+        }
+        if (!child->ring_len) child->ring_start = 0;
+
+        // The free space is one or two pieces, depending on wrap-around.
+        uint end = (child->ring_start + child->ring_len) % child->ring_size;
+        uint free1 = (end >= child->ring_start ? child->ring_size : child->ring_start) - end;
+        uint free2 = end >= child->ring_start ? child->ring_start : 0;
+        free1 = std::min(free1, budget);
+        free2 = std::min(free2, budget - free1);
+        struct iovec iov[2] = {
+            {child->ring + end, free1},
+            {child->ring, free2}
+        };
+        int len = readv(child->pty_fd, iov, free2 ? 2 : 1);
+        if (len > 0) {
+            child->ring_len += len;
+            budget -= len;
+        } else if (len < 0 && (errno == EAGAIN || errno == EINTR)) {
+            // Spurious readiness or a signal: no data for now.
+            break;
+        } else {
+            return false;
         }
     }
+    return true;
+}
+
+// Parse input from the ring until it's empty or the deadline has passed.
+static void drain_ring(struct child* child, long long deadline) {
+    long long start = now_us(), now = start;
+    while (child->ring_len && now < deadline) {
+        uint len = std::min(child->ring_len, child->ring_size - child->ring_start);
+        len = std::min(len, parse_chunk);
+        const char* p = child->ring + child->ring_start;
+        term_write(child->term, p, len);
+        child_log(child, p, len);
+        child->ring_start = (child->ring_start + len) % child->ring_size;
+        child->ring_len -= len;
+        child->bytes_parsed += len;
+        now = now_us();
+    }
+    child->slices++;
+    child->slice_us += now - start;
+    if (child->ring_len)
+        child->slices_exhausted++;
+}
+
+// Async-signal-safe.
+void child_wake() {
+    if (wake_fds[1] >= 0) {
+        int saved_errno = errno;
+        char c = 0;
+        write(wake_fds[1], &c, 1);
+        errno = saved_errno;
+    }
+}
+
+// Wait for events, or until the timeout in milliseconds has passed if
+// that's not negative. Returns whether there's a window message.
+static bool wait_events(int timeout) {
+    if (poll(pollfds.data(), pollfds.size(), timeout) <= 0) {
+        for (struct pollfd& p : pollfds)
+            p.revents = 0;
+    }
+    if (pollfds[POLL_WAKE].revents & POLLIN) {
+        char buf[64];
+        while (read(wake_fds[0], buf, sizeof buf) > 0);
+    }
+    return pollfds[POLL_WIN].revents & POLLIN;
 }
 
 void child_proc() {
     // this code is ripped from child.c
     for (;;) {
-        for (Tab& t : win_tabs()) {
-            if (t.terminal->paste_buffer)
-                term_send_paste(t.terminal.get());
-        }
+        auto& tabs = win_tabs();
 
-        struct timeval timeout = {0, 100000}, *timeout_p = 0;
-        fd_set fds;
-        FD_ZERO(&fds);
-        FD_SET(child_win_fd, &fds);  
-        int highfd = child_win_fd;
-        for (Tab& t : win_tabs()) {
-            if (t.chld->pty_fd > highfd) highfd = t.chld->pty_fd;
-            if (t.chld->pty_fd >= 0) {
-                FD_SET(t.chld->pty_fd, &fds);
-            } else if (t.chld->pid) {
-                int status;
-                if (waitpid(t.chld->pid, &status, WNOHANG) == t.chld->pid) {
-                    t.chld->pid = 0;
-                }
-                else {// Pty gone, but process still there: keep checking
-                    timeout_p = &timeout;
-                }
+        if (exit_signal)
+            child_onexit(exit_signal);
+        if (sigchld_pending)
+            reap_children();
+        trace_dump_if_requested();
+
+        // Wait for the window, ptys or a wake-up, such as for a child
+        // having exited. Don't wait at all if there's input left to parse.
+        // Tabs whose pty has closed go once their process has exited, or
+        // straight away if it's been killed.
+        bool backlog = false, gone = false, idle_rings = false;
+        long long now = now_us();
+        pollfds.resize(tabs.size() + POLL_TABS);
+        pollfds[POLL_WIN] = {child_win_fd, POLLIN, 0};
+        pollfds[POLL_WAKE] = {wake_fds[0], POLLIN, 0};
+        for (uint i = 0; i < tabs.size(); i++) {
+            Tab& t = tabs[i];
+            struct child* child = t.chld.get();
+            short events = 0;
+            if (child->pty_fd >= 0) {
+                events = POLLIN;
+                // Queued output and pastes are sent whenever the pty can
+                // take more.
+                if (child->out_len || t.terminal->paste_buffer)
+                    events |= POLLOUT;
+            }
+            pollfds[i + POLL_TABS] = {events ? child->pty_fd : -1, events, 0};
+            if (!child->ring_len && child->ring) {
+                if (now - child->ring_used_us >= ring_idle_us)
+                    child_release_ring(child);
+                else
+                    idle_rings = true;
+            }
+            if (child->ring_len) {
+                backlog = true;
+            } else if (child->pty_fd < 0 && child->pid &&
+                       (child->exited || child->killed)) {
+                child->pid = 0;
+                gone = true;
             }
         }
 
-        if (select(highfd + 1, &fds, 0, 0, timeout_p) > 0) {
-            for (Tab& t : win_tabs()) {
-                struct child* child = t.chld.get();
-                if (child->pty_fd >= 0 && FD_ISSET(child->pty_fd, &fds)) {
-#if CYGWIN_VERSION_DLL_MAJOR >= 1005
-                    static char buf[4096];
-                    int len = read(child->pty_fd, buf, sizeof buf);
-#else
-                    // Pty devices on old Cygwin version deliver only 4 bytes at a time,
-                    // so call read() repeatedly until we have a worthwhile haul.
-                    static char buf[512];
-                    uint len = 0;
-                    do {
-                        int ret = read(child->pty_fd, buf + len, sizeof buf - len);
-                        if (ret > 0)
-                            len += ret;
-                        else
-                            break;
-                    } while (len < sizeof buf);
-#endif
-                    if (len > 0) {
-                        term_write(child->term, buf, len);
-                        if (child_log_fd >= 0)
-                            write(child_log_fd, buf, len);
-                    } else {
-                        child->pty_fd = -1;
-                        term_hide_cursor(child->term);
-                    }
-                }
-                if (FD_ISSET(child_win_fd, &fds)) {
-                    return;
+        // Let win_tab_clean() close the tabs of children that are gone.
+        if (gone)
+            return;
+
+        // Wake up in time to free rings that have gone idle.
+        bool message =
+            wait_events(backlog ? 0 : idle_rings ? ring_idle_us / 1000 : -1);
+
+        for (uint i = 0; i < tabs.size(); i++) {
+            Tab& t = tabs[i];
+            struct child* child = t.chld.get();
+            short revents = pollfds[i + POLL_TABS].revents;
+            if (child->pty_fd >= 0 && (revents & POLLOUT)) {
+                child_flush(child);
+                if (t.terminal->paste_buffer)
+                    term_send_paste(t.terminal.get());
+            }
+            if (child->pty_fd >= 0 && (revents & (POLLIN | POLLHUP | POLLERR))) {
+                if (!fill_ring(child)) {
+                    child->pty_fd = -1;
+                    child_flush(child);
+                    term_hide_cursor(child->term);
                 }
             }
         }
+
+        uint n = tabs.size();
+        long long pass_end = now_us() + pass_us;
+        for (uint i = 0; i < n; i++) {
+            struct child* child = tabs[(next_tab + i) % n].chld.get();
+            if (!child->ring_len)
+                continue;
+            long long now = now_us();
+            if (now >= pass_end)
+                break;
+            drain_ring(child, std::min(now + slice_us, pass_end));
+        }
+        next_tab = n ? (next_tab + 1) % n : 0;
+
+        // Show what's been parsed so far, if it's time for that.
+        win_update_if_due();
+
+        if (message) {
+            return;
+        }
     }
 }
 
@@ -138,24 +379,67 @@ void child_kill() {
     });
 }
 
+// The tab goes as soon as the child loop sees that its pty is closed.
 void child_terminate(struct child* child) {
-    kill(-child->pid, SIGKILL);
-
-    // Seems that sometimes cygwin leaves process in non-waitable and
-    // non-alive state. The result for that is that there will be
-    // unkillable tabs.
-    //
-    // This stupid hack solves the problem.
-    //
-    // TODO: Find out better way to solve this. Now the child processes are
-    // not always cleaned up.
-    int cpid = child->pid;
-    win_callback(50, [cpid]() {
-        auto& tabs = win_tabs();
-        for (auto& t : tabs) {
-            if (t.chld->pid == cpid) t.chld->pid = 0;
+    if (child->pid)
+        kill(-child->pid, SIGKILL);
+    child->killed = true;
+    if (child->pty_fd >= 0) {
+        close(child->pty_fd);
+        child->pty_fd = -1;
+    }
+}
+
+// Hand a spare shell started in the given directory over to a new tab.
+// Returns false if there isn't one.
+bool child_create_spare(struct child* child, struct term* term,
+        struct winsize *winp, const char* path) {
+    std::string cwd = spare_dir(path);
+    for (auto it = spares.begin(); it != spares.end();) {
+        if (it->cwd != cwd) {
+            ++it;
+            continue;
         }
-    });
+        if (it->chld.exited) {
+            child_free(&it->chld);
+            it = spares.erase(it);
+            continue;
+        }
+        child->pid = it->chld.pid;
+        child->pty_fd = it->chld.pty_fd;
+        child->term = term;
+        child_resize(child, winp);
+        spares.erase(it);
+        return true;
+    }
+    return false;
+}
+
+// Top up the pool of spare shells, to cfg.spare_shells started in the
+// given directory, which is where the next tab is most likely to want
+// one. Spares for other directories make way if there are too many.
+void child_fill_pool(char *cmd, char *argv[], struct winsize *winp,
+        const char* path) {
+    std::string cwd = spare_dir(path);
+    uint wanted = cfg.spare_shells;
+    uint have = std::count_if(spares.begin(), spares.end(),
+            [&](Spare& s) { return s.cwd == cwd; });
+    for (; have < wanted; have++) {
+        if (spares.size() >= wanted) {
+            auto old = std::find_if(spares.begin(), spares.end(),
+                    [&](Spare& s) { return s.cwd != cwd; });
+            kill_spare(*old);
+            spares.erase(old);
+        }
+        Spare spare;
+        memset(&spare.chld, 0, sizeof spare.chld);
+        spare.chld.cmd = cmd;
+        spare.cwd = cwd;
+        child_create(&spare.chld, nullptr, argv, winp, path);
+        if (!spare.chld.pid)
+            break;
+        spares.push_back(std::move(spare));
+    }
 }
 
 bool child_is_any_parent() {
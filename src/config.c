@@ -65,6 +65,8 @@ const config default_cfg = {
   .rows = 24,
   .scrollbar = 1,
   .scrollback_lines = 10000,
+  .hibernate_delay = 300,
+  .spare_shells = 0,
   .scroll_mod = MDK_SHIFT,
   .pgupdn_scroll = false,
   // Terminal
@@ -83,6 +85,8 @@ const config default_cfg = {
   .hold = HOLD_START,
   .icon = "",
   .log = "",
+  .log_headers = false,
+  .log_max_size = 0,
   .utmp = false,
   .title = "",
   .title_settable = true,
@@ -94,6 +98,7 @@ const config default_cfg = {
   .word_chars_excl = "",
   .use_system_colours = false,
   .ime_cursor_colour = DEFAULT_COLOUR,
+  .paint_flashing = false,
   .ansi_colours = {
     [BLACK_I]        = 0x000000,
     [RED_I]          = 0x0000BF,
@@ -184,6 +189,8 @@ options[] = {
   {"Columns", OPT_INT, offcfg(cols)},
   {"Rows", OPT_INT, offcfg(rows)},
   {"ScrollbackLines", OPT_INT, offcfg(scrollback_lines)},
+  {"HibernateDelay", OPT_INT, offcfg(hibernate_delay)},
+  {"SpareShells", OPT_INT, offcfg(spare_shells)},
   {"Scrollbar", OPT_SCROLLBAR, offcfg(scrollbar)},
   {"ScrollMod", OPT_MOD, offcfg(scroll_mod)},
   {"PgUpDnScroll", OPT_BOOL, offcfg(pgupdn_scroll)},
@@ -205,6 +212,8 @@ options[] = {
   {"Hold", OPT_HOLD, offcfg(hold)},
   {"Icon", OPT_STRING, offcfg(icon)},
   {"Log", OPT_STRING, offcfg(log)},
+  {"LogHeaders", OPT_BOOL, offcfg(log_headers)},
+  {"LogMaxSize", OPT_INT, offcfg(log_max_size)},
   {"Title", OPT_STRING, offcfg(title)},
   {"TitleSettable", OPT_BOOL, offcfg(title_settable)},
   {"Utmp", OPT_BOOL, offcfg(utmp)},
@@ -219,6 +228,7 @@ options[] = {
   {"WordChars", OPT_STRING, offcfg(word_chars)},
   {"WordCharsExcl", OPT_STRING, offcfg(word_chars_excl)},
   {"IMECursorColour", OPT_COLOUR, offcfg(ime_cursor_colour)},
+  {"PaintFlashing", OPT_BOOL, offcfg(paint_flashing)},
 
   // ANSI colours
   {"Black", OPT_COLOUR, offcfg(ansi_colours[BLACK_I])},
@@ -564,6 +574,9 @@ finish_config(void)
   cfg.rows = max(1, cfg.rows);
   cfg.cols = max(1, cfg.cols);
   cfg.scrollback_lines = max(0, cfg.scrollback_lines);
+  cfg.hibernate_delay = max(0, cfg.hibernate_delay);
+  cfg.spare_shells = max(0, cfg.spare_shells);
+  cfg.log_max_size = max(0, cfg.log_max_size);
 
   // Ignore charset setting if we haven't got a locale.
   if (!*cfg.locale)
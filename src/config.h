@@ -80,6 +80,8 @@ typedef struct {
   // Window
   int cols, rows;
   int scrollback_lines;
+  int hibernate_delay;
+  int spare_shells;
   char scrollbar;
   char scroll_mod;
   bool pgupdn_scroll;
@@ -99,6 +101,8 @@ typedef struct {
   char hold;
   string icon;
   string log;
+  bool log_headers;
+  int log_max_size;
   string title;
   bool title_settable;
   bool utmp;
@@ -110,6 +114,7 @@ typedef struct {
   string word_chars;
   string word_chars_excl;
   colour ime_cursor_colour;
+  bool paint_flashing;
   colour ansi_colours[16];
   // Legacy
   bool use_system_colours;
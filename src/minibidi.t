@@ -0,0 +1,2229 @@
+/*
+ * Generated by mkunitab bidi from Unicode 14.0.0. Do not edit.
+ */
+
+enum { BIDI_TYPE_SHIFT = 4, BIDI_TYPE_MASK = 15 };
+
+static const uchar bidi_type_index[4096] = {
+  0, 1, 2, 3, 4, 5, 4, 6, 7, 8, 9, 10, 11, 12, 11, 12,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 13, 14, 14, 15, 16,
+  17, 17, 17, 17, 17, 17, 17, 18, 19, 11, 11, 11, 11, 11, 11, 20,
+  11, 11, 11, 11, 11, 11, 11, 11, 21, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 22, 23, 17, 24, 25, 26, 26, 26,
+  27, 28, 29, 29, 30, 17, 31, 32, 29, 29, 29, 29, 29, 33, 34, 35,
+  29, 36, 29, 17, 28, 29, 29, 29, 29, 29, 37, 32, 26, 26, 38, 39,
+  26, 40, 41, 26, 26, 42, 29, 29, 29, 43, 29, 29, 44, 17, 45, 17,
+  46, 11, 11, 47, 48, 49, 50, 11, 51, 11, 11, 52, 53, 11, 50, 54,
+  55, 11, 11, 52, 56, 51, 11, 57, 55, 11, 11, 52, 58, 11, 50, 59,
+  51, 11, 11, 60, 53, 61, 50, 11, 62, 11, 11, 11, 63, 11, 11, 64,
+  65, 11, 11, 66, 67, 61, 50, 68, 51, 11, 11, 52, 69, 11, 50, 11,
+  70, 11, 11, 71, 53, 11, 50, 11, 51, 11, 11, 11, 72, 73, 11, 11,
+  11, 11, 11, 74, 75, 11, 11, 11, 11, 11, 11, 76, 77, 11, 11, 11,
+  11, 78, 11, 79, 11, 11, 11, 80, 81, 82, 17, 83, 84, 11, 11, 11,
+  11, 11, 85, 86, 11, 87, 88, 89, 90, 91, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 85, 11, 11, 11, 92, 11, 11, 11, 11, 11, 11,
+  4, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 93, 94, 11, 11, 11, 11, 11, 11,
+  11, 95, 11, 50, 11, 50, 11, 50, 11, 11, 11, 96, 97, 98, 11, 92,
+  99, 11, 11, 11, 11, 11, 11, 11, 61, 11, 100, 11, 11, 11, 11, 11,
+  11, 11, 101, 102, 103, 11, 11, 11, 11, 11, 11, 11, 11, 104, 16, 16,
+  11, 105, 11, 11, 11, 106, 107, 108, 11, 11, 11, 17, 109, 11, 11, 11,
+  110, 11, 11, 111, 62, 11, 112, 110, 70, 11, 113, 11, 11, 11, 114, 70,
+  11, 11, 115, 116, 11, 11, 11, 11, 11, 11, 11, 11, 11, 117, 118, 119,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 17, 17, 17, 17,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 120, 121, 122, 122, 123,
+  124, 16, 125, 126, 127, 128, 129, 130, 131, 11, 132, 132, 132, 17, 17, 88,
+  133, 134, 135, 136, 137, 16, 11, 11, 138, 16, 16, 16, 16, 16, 16, 16,
+  16, 139, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 140, 11, 11, 11, 5, 16, 141, 16, 16, 16, 16, 16, 16,
+  16, 16, 142, 11, 143, 11, 16, 16, 144, 145, 11, 11, 11, 11, 146, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 147, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 148, 16, 149, 16, 16, 16, 16, 16, 16,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 150, 151,
+  11, 11, 11, 11, 11, 11, 11, 152, 11, 11, 11, 11, 11, 11, 17, 17,
+  16, 16, 16, 16, 16, 153, 11, 11, 16, 154, 16, 16, 16, 16, 16, 155,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 140, 11, 156,
+  157, 16, 158, 159, 11, 11, 11, 11, 11, 160, 4, 11, 11, 11, 11, 161,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 16, 16, 155, 11,
+  11, 123, 11, 11, 11, 16, 11, 162, 11, 11, 11, 163, 164, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 165, 11, 11, 11, 11, 11, 104, 11, 166,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 16, 16, 16, 16,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 16, 16, 16, 142, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  122, 11, 11, 11, 11, 11, 152, 167, 11, 168, 11, 11, 11, 11, 11, 70,
+  16, 16, 169, 11, 11, 11, 11, 11, 170, 11, 11, 11, 11, 11, 11, 11,
+  171, 11, 172, 173, 11, 11, 11, 174, 11, 11, 11, 11, 175, 11, 17, 176,
+  11, 11, 177, 11, 178, 70, 11, 11, 46, 11, 11, 179, 11, 11, 180, 11,
+  11, 11, 181, 182, 183, 11, 11, 52, 11, 11, 11, 184, 51, 11, 69, 84,
+  11, 11, 11, 11, 11, 11, 136, 11, 11, 11, 11, 11, 11, 11, 185, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 186, 187, 26, 26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 188, 16, 29, 29, 29, 29, 29, 29, 29, 189, 8, 8, 190,
+  17, 92, 17, 16, 16, 191, 192, 29, 29, 29, 29, 29, 29, 29, 29, 193,
+  194, 3, 4, 5, 4, 5, 140, 11, 11, 11, 11, 11, 11, 11, 195, 196,
+};
+
+static const uchar bidi_type_blocks[][16] = {
+  {
+    BN, BN, BN, BN, BN, BN, BN, BN,
+    BN, S, B, S, WS, B, BN, BN,
+  },
+  {
+    BN, BN, BN, BN, BN, BN, BN, BN,
+    BN, BN, BN, BN, B, B, B, S,
+  },
+  {
+    WS, ON, ON, ET, ET, ET, ON, ON,
+    ON, ON, ON, ES, CS, ES, CS, CS,
+  },
+  {
+    EN, EN, EN, EN, EN, EN, EN, EN,
+    EN, EN, CS, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, ON, ON, ON, ON, BN,
+  },
+  {
+    BN, BN, BN, BN, BN, B, BN, BN,
+    BN, BN, BN, BN, BN, BN, BN, BN,
+  },
+  {
+    BN, BN, BN, BN, BN, BN, BN, BN,
+    BN, BN, BN, BN, BN, BN, BN, BN,
+  },
+  {
+    CS, ON, ET, ET, ET, ET, ON, ON,
+    ON, ON, L, ON, ON, BN, ON, ON,
+  },
+  {
+    ET, ET, EN, EN, ON, L, ON, ON,
+    ON, EN, L, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, ON,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, ON, ON, L, L, L, L, L,
+  },
+  {
+    L, L, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, L, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    L, L, L, L, ON, ON, L, L,
+    L, L, L, L, L, L, ON, L,
+  },
+  {
+    L, L, L, L, ON, ON, L, ON,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, ON, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, ON, L, L, ON, ON, ET,
+  },
+  {
+    R, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, R, NSM,
+  },
+  {
+    R, NSM, NSM, R, NSM, NSM, R, NSM,
+    R, R, R, R, R, R, R, R,
+  },
+  {
+    R, R, R, R, R, R, R, R,
+    R, R, R, R, R, R, R, R,
+  },
+  {
+    AN, AN, AN, AN, AN, AN, ON, ON,
+    AL, ET, ET, AL, CS, AL, ON, ON,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, AL, AL, AL, AL, AL,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, AL, AL,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    AN, AN, AN, AN, AN, AN, AN, AN,
+    AN, AN, ET, AN, AN, AL, AL, AL,
+  },
+  {
+    NSM, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, AL, AL,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, AN, ON, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, AL, AL, NSM,
+    NSM, ON, NSM, NSM, NSM, NSM, AL, AL,
+  },
+  {
+    EN, EN, EN, EN, EN, EN, EN, EN,
+    EN, EN, AL, AL, AL, AL, AL, AL,
+  },
+  {
+    AL, NSM, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, AL, AL,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    R, R, R, R, R, R, R, R,
+    R, R, R, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, R, R, ON, ON,
+    ON, ON, R, R, R, NSM, R, R,
+  },
+  {
+    R, R, R, R, R, R, NSM, NSM,
+    NSM, NSM, R, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, R, NSM, NSM, NSM,
+    R, NSM, NSM, NSM, NSM, NSM, R, R,
+  },
+  {
+    R, R, R, R, R, R, R, R,
+    R, NSM, NSM, NSM, R, R, R, R,
+  },
+  {
+    AN, AN, AL, AL, AL, AL, AL, AL,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, AN, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, NSM, L, NSM, L, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, NSM, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, NSM, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, NSM, L, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, L, L, L,
+    L, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, L, ET, ET, L, L, L, L,
+    L, L, L, ET, L, L, NSM, L,
+  },
+  {
+    L, NSM, NSM, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, NSM, NSM, L, L, L, L, NSM,
+    NSM, L, L, NSM, NSM, NSM, L, L,
+  },
+  {
+    NSM, NSM, L, L, L, NSM, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, NSM, L, NSM,
+    NSM, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, ET, L, L, L, L, L, L,
+    L, L, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, NSM, L, L, NSM,
+  },
+  {
+    L, L, L, L, L, NSM, NSM, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    NSM, L, L, L, L, L, L, L,
+    L, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, L, L, ON, ON, ON, ON, ON,
+    ON, ET, ON, L, L, L, L, L,
+  },
+  {
+    NSM, L, L, L, NSM, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, NSM, L, NSM, NSM,
+  },
+  {
+    NSM, L, L, L, L, L, NSM, NSM,
+    NSM, L, NSM, NSM, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    ON, ON, ON, ON, ON, ON, ON, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, NSM, NSM, L, L,
+  },
+  {
+    NSM, NSM, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, NSM, NSM, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, NSM, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, NSM, NSM, L, NSM, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, NSM, L, L, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, L, L, L, L, ET,
+  },
+  {
+    L, L, L, L, L, L, L, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, L,
+  },
+  {
+    L, NSM, L, L, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    NSM, NSM, NSM, NSM, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    NSM, NSM, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, NSM, L, NSM,
+    L, NSM, ON, ON, ON, ON, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, L,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, L, NSM, NSM,
+    L, L, L, L, L, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    L, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, NSM, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, NSM, NSM, NSM,
+  },
+  {
+    NSM, L, NSM, NSM, NSM, NSM, NSM, NSM,
+    L, NSM, NSM, L, L, NSM, NSM, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    NSM, NSM, L, L, L, L, NSM, NSM,
+  },
+  {
+    NSM, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, NSM, NSM, NSM, NSM, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, L, L, NSM, NSM, L,
+    L, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, NSM, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, L, L, L, L, L, L,
+  },
+  {
+    WS, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, ON, ON, L, L, L,
+  },
+  {
+    L, L, NSM, NSM, NSM, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, NSM, NSM, L, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, NSM, L,
+    L, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, L, L, L, L,
+    L, L, L, ET, L, NSM, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, NSM, NSM, NSM, BN, NSM,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, NSM, L, L, L, L, L, L,
+  },
+  {
+    NSM, NSM, NSM, L, L, L, L, NSM,
+    NSM, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, L, L, L, L, L,
+    L, NSM, NSM, NSM, L, L, L, L,
+  },
+  {
+    ON, L, L, L, ON, ON, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, NSM,
+    NSM, L, L, NSM, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, NSM, L,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, L,
+  },
+  {
+    NSM, L, NSM, L, L, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, L, L, L,
+  },
+  {
+    L, L, L, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, L, L, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, L,
+  },
+  {
+    NSM, NSM, NSM, NSM, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, NSM, L, NSM, NSM,
+    NSM, NSM, NSM, L, NSM, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    L, L, NSM, NSM, NSM, NSM, L, L,
+    NSM, NSM, L, NSM, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, NSM, L,
+    NSM, NSM, L, L, L, NSM, L, NSM,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, NSM, NSM, NSM, L, L, NSM, NSM,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    NSM, NSM, NSM, L, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    NSM, L, NSM, NSM, NSM, NSM, NSM, NSM,
+    NSM, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, L, L, L, NSM, L, L, L,
+    NSM, NSM, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, ON, L, ON,
+  },
+  {
+    ON, ON, L, L, L, L, L, L,
+    L, L, L, L, L, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, ON, ON, L,
+  },
+  {
+    WS, WS, WS, WS, WS, WS, WS, WS,
+    WS, WS, WS, BN, BN, BN, L, R,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    WS, B, LRE, RLE, PDF, LRO, RLO, CS,
+  },
+  {
+    ET, ET, ET, ET, ET, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, CS, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, WS,
+  },
+  {
+    BN, BN, BN, BN, BN, BN, ON, ON,
+    ON, ON, BN, BN, BN, BN, BN, BN,
+  },
+  {
+    EN, L, L, L, EN, EN, EN, EN,
+    EN, EN, ES, ES, ON, ON, ON, L,
+  },
+  {
+    EN, EN, EN, EN, EN, EN, EN, EN,
+    EN, EN, ES, ES, ON, ON, ON, L,
+  },
+  {
+    ET, ET, ET, ET, ET, ET, ET, ET,
+    ET, ET, ET, ET, ET, ET, ET, ET,
+  },
+  {
+    ON, ON, L, ON, ON, ON, ON, L,
+    ON, ON, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, ON, L, ON, ON,
+    ON, L, L, L, L, L, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, L, ON, L, ON,
+    L, ON, L, L, L, L, ET, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, ON, ON, L, L, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, L, L, L,
+    L, L, ON, ON, ON, ON, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, ON, ON, ON, L, L, L, L,
+  },
+  {
+    ON, ON, ES, ET, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, L, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, L, L, L, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    EN, EN, EN, EN, EN, EN, EN, EN,
+  },
+  {
+    EN, EN, EN, EN, EN, EN, EN, EN,
+    EN, EN, EN, EN, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, L, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, L, L, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, L, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, ON, ON, ON,
+    ON, ON, ON, L, L, L, L, NSM,
+  },
+  {
+    NSM, NSM, L, L, L, L, L, L,
+    L, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, NSM,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, L, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, ON, ON, ON, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    ON, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, L, L, L, L,
+  },
+  {
+    WS, ON, ON, ON, ON, L, L, L,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    ON, L, L, L, L, L, L, L,
+    L, L, NSM, NSM, NSM, NSM, L, L,
+  },
+  {
+    ON, L, L, L, L, L, ON, ON,
+    L, L, L, L, L, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, NSM, NSM, ON, ON, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, ON, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, ON, ON, ON, L,
+  },
+  {
+    L, ON, ON, ON, ON, ON, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, ON, ON, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, ON,
+    ON, ON, ON, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, ON,
+  },
+  {
+    NSM, NSM, NSM, ON, NSM, NSM, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, ON, ON,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, L, NSM, NSM,
+  },
+  {
+    ON, ON, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    ON, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, NSM, L, L, L, NSM, L,
+    L, L, L, NSM, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, NSM, NSM, L,
+    ON, ON, ON, ON, NSM, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    ET, ET, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, ON, ON, ON, ON,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, NSM, NSM, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    NSM, NSM, L, L, L, L, L, L,
+    L, L, L, L, L, L, L, NSM,
+  },
+  {
+    L, L, L, L, L, L, NSM, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, NSM,
+    NSM, NSM, NSM, NSM, NSM, NSM, NSM, NSM,
+  },
+  {
+    L, L, L, NSM, L, L, NSM, NSM,
+    NSM, NSM, L, L, NSM, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, NSM, L, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, NSM, NSM, NSM, NSM, NSM, NSM, L,
+  },
+  {
+    L, NSM, NSM, L, L, NSM, NSM, L,
+    L, L, L, L, L, L, L, L,
+  },
+  {
+    L, L, L, NSM, L, L, L, L,
+    L, L, L, L, NSM, L, L, L,
+  },
+  {
+    NSM, L, NSM, NSM, NSM, L, L, NSM,
+    NSM, L, L, L, L, L, NSM, NSM,
+  },
+  {
+    L, L, L, L, L, NSM, L, L,
+    NSM, L, L, L, L, NSM, L, L,
+  },
+  {
+    L, L, L, L, L, L, L, L,
+    L, L, L, L, L, R, NSM, R,
+  },
+  {
+    R, R, R, R, R, R, R, R,
+    R, ES, R, R, R, R, R, R,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, ON, ON,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, AL, ON,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, ON, ON, ON,
+  },
+  {
+    CS, ON, CS, L, ON, CS, ON, ON,
+    ON, ON, ON, ON, ON, ON, ON, ET,
+  },
+  {
+    ON, ON, ES, ES, ON, ON, ON, L,
+    ON, ET, ET, ON, L, L, L, L,
+  },
+  {
+    AL, AL, AL, AL, AL, AL, AL, AL,
+    AL, AL, AL, AL, AL, AL, AL, BN,
+  },
+  {
+    L, ON, ON, ET, ET, ET, ON, ON,
+    ON, ON, ON, ES, CS, ES, CS, CS,
+  },
+  {
+    ET, ET, ON, ON, ON, ET, ET, L,
+    ON, ON, ON, ON, ON, ON, ON, L,
+  },
+  {
+    BN, BN, BN, BN, BN, BN, BN, BN,
+    BN, ON, ON, ON, ON, ON, BN, BN,
+  },
+};
+
+enum { MIRROR_SHIFT = 5, MIRROR_MASK = 31 };
+
+static const uchar mirror_index[2048] = {
+  0, 1, 2, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 21, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 25, 26,
+  0, 27, 0, 28, 29, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 33,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  34, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 38, 39, 0, 0, 0, 0, 1, 2, 40, 41, 0, 0, 0, 0,
+};
+
+static const short mirror_blocks[][32] = {
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, -2, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, -2, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -16, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -1, 1, -1, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -1, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, -1, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, -3, -3, -3, 0, 0,
+    0, 0, 0, 0, 0, 2016, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2527,
+  },
+  {
+    1923, 1914, 1918, 0, 2250, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, 0,
+  },
+  {
+    0, 0, 0, 138, 0, 7, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 1, -1, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 1, -1, 1, -1,
+    1, -1, 1, -1, 0, 0, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1,
+  },
+  {
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 0, 0, 0, 1,
+    -1, 1, -1, 0, 0, 0, 0, 0,
+    1824, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 1, -1, 0, 0, 2104, 0,
+    2108, 2106, 0, 2106, 0, 0, 0, 0,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1316, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 1, -1, -138, 0, 0,
+    1, -1, 0, 0, 0, 0, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1,
+  },
+  {
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, 0,
+    1, -1, 8, 8, 8, 0, 7, 7,
+    0, 0, -8, -8, -8, -7, -7, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -1, 1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 1, -1, 1, -1, 0,
+    1, -1, 0, 2, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 1, -1, 0,
+    0, 0, 0, 0, -1316, 1, -1, 0,
+  },
+  {
+    0, 0, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 3, 1, -1,
+    -3, 1, -1, 1, -1, 1, -1, 1,
+    -1, 0, 0, -1914, 0, 0, 0, 0,
+  },
+  {
+    -1918, 0, 0, -1923, 1, -1, 0, 0,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1824, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    1, -1, 0, 0, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    -1, 1, -1, 0, 1, -1, 0, 0,
+    1, -1, 1, -1, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2016, 0, 0,
+    1, -1, 0, 0, 1, -1, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -1, 1, -1, 0,
+    0, 0, 0, 0, 1, -1, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 1, -1, 1, -1, 1,
+  },
+  {
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+  },
+  {
+    -1, 1, -1, 0, 0, 0, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+  },
+  {
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, 0,
+    0, 0, 0, 0, 0, 0, -2104, 0,
+  },
+  {
+    0, 0, 0, -2106, -2108, -2106, 0, 0,
+    0, 0, 0, 0, 1, -1, -2250, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    -1, 1, -1, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2527, 0,
+  },
+  {
+    0, 0, 1, -1, 1, -1, 0, 0,
+    0, 1, -1, 0, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, 0,
+  },
+  {
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, -1, 1,
+    -1, 1, -1, 1, -1, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, 0, 1, -1, 1, -1,
+    1, -1, 1, -1, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 1, -1, 1, -1, 0,
+  },
+  {
+    0, 0, 0, 0, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, -2, 0, 1,
+  },
+  {
+    -1, 0, 1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+};
+
+static const shape_node shape_nodes[] = {
+ /* char, type, isolated, final, initial, medial */
+ /* none */ {SU, {0, 0, 0, 0}},
+ /* 0620 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0621 */ {SU, {0xFE80, 0x0000, 0x0000, 0x0000}},
+ /* 0622 */ {SR, {0xFE81, 0xFE82, 0x0000, 0x0000}},
+ /* 0623 */ {SR, {0xFE83, 0xFE84, 0x0000, 0x0000}},
+ /* 0624 */ {SR, {0xFE85, 0xFE86, 0x0000, 0x0000}},
+ /* 0625 */ {SR, {0xFE87, 0xFE88, 0x0000, 0x0000}},
+ /* 0626 */ {SD, {0xFE89, 0xFE8A, 0xFE8B, 0xFE8C}},
+ /* 0627 */ {SR, {0xFE8D, 0xFE8E, 0x0000, 0x0000}},
+ /* 0628 */ {SD, {0xFE8F, 0xFE90, 0xFE91, 0xFE92}},
+ /* 0629 */ {SR, {0xFE93, 0xFE94, 0x0000, 0x0000}},
+ /* 062A */ {SD, {0xFE95, 0xFE96, 0xFE97, 0xFE98}},
+ /* 062B */ {SD, {0xFE99, 0xFE9A, 0xFE9B, 0xFE9C}},
+ /* 062C */ {SD, {0xFE9D, 0xFE9E, 0xFE9F, 0xFEA0}},
+ /* 062D */ {SD, {0xFEA1, 0xFEA2, 0xFEA3, 0xFEA4}},
+ /* 062E */ {SD, {0xFEA5, 0xFEA6, 0xFEA7, 0xFEA8}},
+ /* 062F */ {SR, {0xFEA9, 0xFEAA, 0x0000, 0x0000}},
+ /* 0630 */ {SR, {0xFEAB, 0xFEAC, 0x0000, 0x0000}},
+ /* 0631 */ {SR, {0xFEAD, 0xFEAE, 0x0000, 0x0000}},
+ /* 0632 */ {SR, {0xFEAF, 0xFEB0, 0x0000, 0x0000}},
+ /* 0633 */ {SD, {0xFEB1, 0xFEB2, 0xFEB3, 0xFEB4}},
+ /* 0634 */ {SD, {0xFEB5, 0xFEB6, 0xFEB7, 0xFEB8}},
+ /* 0635 */ {SD, {0xFEB9, 0xFEBA, 0xFEBB, 0xFEBC}},
+ /* 0636 */ {SD, {0xFEBD, 0xFEBE, 0xFEBF, 0xFEC0}},
+ /* 0637 */ {SD, {0xFEC1, 0xFEC2, 0xFEC3, 0xFEC4}},
+ /* 0638 */ {SD, {0xFEC5, 0xFEC6, 0xFEC7, 0xFEC8}},
+ /* 0639 */ {SD, {0xFEC9, 0xFECA, 0xFECB, 0xFECC}},
+ /* 063A */ {SD, {0xFECD, 0xFECE, 0xFECF, 0xFED0}},
+ /* 063B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 063C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 063D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 063E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 063F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0640 */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0641 */ {SD, {0xFED1, 0xFED2, 0xFED3, 0xFED4}},
+ /* 0642 */ {SD, {0xFED5, 0xFED6, 0xFED7, 0xFED8}},
+ /* 0643 */ {SD, {0xFED9, 0xFEDA, 0xFEDB, 0xFEDC}},
+ /* 0644 */ {SD, {0xFEDD, 0xFEDE, 0xFEDF, 0xFEE0}},
+ /* 0645 */ {SD, {0xFEE1, 0xFEE2, 0xFEE3, 0xFEE4}},
+ /* 0646 */ {SD, {0xFEE5, 0xFEE6, 0xFEE7, 0xFEE8}},
+ /* 0647 */ {SD, {0xFEE9, 0xFEEA, 0xFEEB, 0xFEEC}},
+ /* 0648 */ {SR, {0xFEED, 0xFEEE, 0x0000, 0x0000}},
+ /* 0649 */ {SD, {0xFEEF, 0xFEF0, 0xFBE8, 0xFBE9}},
+ /* 064A */ {SD, {0xFEF1, 0xFEF2, 0xFEF3, 0xFEF4}},
+ /* 066E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 066F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0671 */ {SR, {0xFB50, 0xFB51, 0x0000, 0x0000}},
+ /* 0672 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0673 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0675 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0676 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0677 */ {SR, {0xFBDD, 0x0000, 0x0000, 0x0000}},
+ /* 0678 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0679 */ {SD, {0xFB66, 0xFB67, 0xFB68, 0xFB69}},
+ /* 067A */ {SD, {0xFB5E, 0xFB5F, 0xFB60, 0xFB61}},
+ /* 067B */ {SD, {0xFB52, 0xFB53, 0xFB54, 0xFB55}},
+ /* 067C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 067D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 067E */ {SD, {0xFB56, 0xFB57, 0xFB58, 0xFB59}},
+ /* 067F */ {SD, {0xFB62, 0xFB63, 0xFB64, 0xFB65}},
+ /* 0680 */ {SD, {0xFB5A, 0xFB5B, 0xFB5C, 0xFB5D}},
+ /* 0681 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0682 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0683 */ {SD, {0xFB76, 0xFB77, 0xFB78, 0xFB79}},
+ /* 0684 */ {SD, {0xFB72, 0xFB73, 0xFB74, 0xFB75}},
+ /* 0685 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0686 */ {SD, {0xFB7A, 0xFB7B, 0xFB7C, 0xFB7D}},
+ /* 0687 */ {SD, {0xFB7E, 0xFB7F, 0xFB80, 0xFB81}},
+ /* 0688 */ {SR, {0xFB88, 0xFB89, 0x0000, 0x0000}},
+ /* 0689 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 068A */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 068B */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 068C */ {SR, {0xFB84, 0xFB85, 0x0000, 0x0000}},
+ /* 068D */ {SR, {0xFB82, 0xFB83, 0x0000, 0x0000}},
+ /* 068E */ {SR, {0xFB86, 0xFB87, 0x0000, 0x0000}},
+ /* 068F */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0690 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0691 */ {SR, {0xFB8C, 0xFB8D, 0x0000, 0x0000}},
+ /* 0692 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0693 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0694 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0695 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0696 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0697 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0698 */ {SR, {0xFB8A, 0xFB8B, 0x0000, 0x0000}},
+ /* 0699 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 069F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A4 */ {SD, {0xFB6A, 0xFB6B, 0xFB6C, 0xFB6D}},
+ /* 06A5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A6 */ {SD, {0xFB6E, 0xFB6F, 0xFB70, 0xFB71}},
+ /* 06A7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06A9 */ {SD, {0xFB8E, 0xFB8F, 0xFB90, 0xFB91}},
+ /* 06AA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06AB */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06AC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06AD */ {SD, {0xFBD3, 0xFBD4, 0xFBD5, 0xFBD6}},
+ /* 06AE */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06AF */ {SD, {0xFB92, 0xFB93, 0xFB94, 0xFB95}},
+ /* 06B0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B1 */ {SD, {0xFB9A, 0xFB9B, 0xFB9C, 0xFB9D}},
+ /* 06B2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B3 */ {SD, {0xFB96, 0xFB97, 0xFB98, 0xFB99}},
+ /* 06B4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06B9 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06BA */ {SD, {0xFB9E, 0xFB9F, 0x0000, 0x0000}},
+ /* 06BB */ {SD, {0xFBA0, 0xFBA1, 0xFBA2, 0xFBA3}},
+ /* 06BC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06BD */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06BE */ {SD, {0xFBAA, 0xFBAB, 0xFBAC, 0xFBAD}},
+ /* 06BF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06C0 */ {SR, {0xFBA4, 0xFBA5, 0x0000, 0x0000}},
+ /* 06C1 */ {SD, {0xFBA6, 0xFBA7, 0xFBA8, 0xFBA9}},
+ /* 06C2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06C3 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06C4 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06C5 */ {SR, {0xFBE0, 0xFBE1, 0x0000, 0x0000}},
+ /* 06C6 */ {SR, {0xFBD9, 0xFBDA, 0x0000, 0x0000}},
+ /* 06C7 */ {SR, {0xFBD7, 0xFBD8, 0x0000, 0x0000}},
+ /* 06C8 */ {SR, {0xFBDB, 0xFBDC, 0x0000, 0x0000}},
+ /* 06C9 */ {SR, {0xFBE2, 0xFBE3, 0x0000, 0x0000}},
+ /* 06CA */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06CB */ {SR, {0xFBDE, 0xFBDF, 0x0000, 0x0000}},
+ /* 06CC */ {SD, {0xFBFC, 0xFBFD, 0xFBFE, 0xFBFF}},
+ /* 06CD */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06CE */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06CF */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06D0 */ {SD, {0xFBE4, 0xFBE5, 0xFBE6, 0xFBE7}},
+ /* 06D1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06D2 */ {SR, {0xFBAE, 0xFBAF, 0x0000, 0x0000}},
+ /* 06D3 */ {SR, {0xFBB0, 0xFBB1, 0x0000, 0x0000}},
+ /* 06D5 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06EE */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06EF */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06FA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06FB */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06FC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 06FF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0710 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0712 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0713 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0714 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0715 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0716 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0717 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0718 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0719 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071E */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 071F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0720 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0721 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0722 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0723 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0724 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0725 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0726 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0727 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0728 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0729 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072A */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072C */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 072F */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 074D */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 074E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 074F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0750 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0751 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0752 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0753 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0754 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0755 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0756 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0757 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0758 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0759 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075A */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075B */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 075F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0760 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0761 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0762 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0763 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0764 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0765 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0766 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0767 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0768 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0769 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076B */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076C */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 076F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0770 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0771 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0772 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0773 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0774 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0775 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0776 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0777 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0778 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0779 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 077F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CB */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CD */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CE */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07CF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07D9 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DB */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DD */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DE */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07DF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07E9 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07EA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 07FA */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0840 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0841 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0842 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0843 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0844 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0845 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0846 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0847 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0848 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0849 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 084F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0850 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0851 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0852 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0853 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0854 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0855 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0856 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0857 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0858 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0860 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0862 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0863 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0864 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0865 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0867 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0868 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0869 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 086A */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0870 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0871 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0872 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0873 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0874 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0875 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0876 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0877 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0878 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0879 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087A */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087B */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087C */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087D */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087E */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 087F */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0880 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0881 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0882 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0883 */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0884 */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0885 */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0886 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 0889 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 088A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 088B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 088C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 088D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 088E */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08A9 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08AA */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08AB */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08AC */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08AE */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08AF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B1 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B2 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08B9 */ {SR, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BB */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BC */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BD */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BE */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08BF */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 08C8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1807 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 180A */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1820 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1821 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1822 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1823 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1824 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1825 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1826 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1827 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1828 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1829 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 182F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1830 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1831 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1832 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1833 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1834 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1835 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1836 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1837 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1838 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1839 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 183F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1840 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1841 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1842 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1843 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1844 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1845 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1846 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1847 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1848 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1849 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 184F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1850 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1851 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1852 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1853 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1854 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1855 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1856 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1857 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1858 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1859 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 185F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1860 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1861 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1862 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1863 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1864 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1865 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1866 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1867 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1868 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1869 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 186F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1870 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1871 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1872 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1873 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1874 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1875 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1876 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1877 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1878 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1887 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1888 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1889 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 188F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1890 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1891 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1892 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1893 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1894 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1895 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1896 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1897 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1898 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 1899 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 189F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A0 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A1 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A2 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A3 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A4 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A5 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A6 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A7 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18A8 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 18AA */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* 200D */ {SC, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A840 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A841 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A842 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A843 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A844 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A845 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A846 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A847 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A848 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A849 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A84F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A850 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A851 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A852 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A853 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A854 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A855 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A856 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A857 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A858 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A859 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A85F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A860 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A861 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A862 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A863 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A864 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A865 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A866 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A867 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A868 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A869 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86A */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86B */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86C */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86D */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86E */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A86F */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A870 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A871 */ {SD, {0x0000, 0x0000, 0x0000, 0x0000}},
+ /* A872 */ {SL, {0x0000, 0x0000, 0x0000, 0x0000}},
+};
+
+/* Index into shape_nodes[], or 0 for characters that don't join. */
+enum { SHAPE_SHIFT = 6, SHAPE_MASK = 63 };
+
+static const uchar shape_index[1024] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 7,
+  0, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 12, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const ushort shape_blocks[][64] = {
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32,
+  },
+  {
+    33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 44, 45,
+    0, 46, 47, 48, 0, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59,
+  },
+  {
+    60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91,
+    92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123,
+  },
+  {
+    124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139,
+    140, 141, 142, 143, 0, 144, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 145, 146,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 147, 148, 149, 0, 0, 150,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    151, 0, 152, 153, 154, 155, 156, 157,
+    158, 159, 160, 161, 162, 163, 164, 165,
+    166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 182, 183, 184,
+    185, 186, 187, 188, 189, 190, 191, 192,
+    193, 194, 195, 196, 197, 198, 199, 200,
+    201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216,
+    217, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 228, 229, 230, 231, 232,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 233, 234, 235, 236, 237, 238,
+    239, 240, 241, 242, 243, 244, 245, 246,
+    247, 248, 249, 250, 251, 252, 253, 254,
+    255, 256, 257, 258, 259, 260, 261, 262,
+    263, 264, 265, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 266, 0, 0, 0, 0, 0,
+  },
+  {
+    267, 268, 269, 270, 271, 272, 273, 274,
+    275, 276, 277, 278, 279, 280, 281, 282,
+    283, 284, 285, 286, 287, 288, 289, 290,
+    291, 0, 0, 0, 0, 0, 0, 0,
+    292, 0, 293, 294, 295, 296, 0, 297,
+    298, 299, 300, 0, 0, 0, 0, 0,
+    301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316,
+  },
+  {
+    317, 318, 319, 320, 321, 322, 323, 0,
+    0, 324, 325, 326, 327, 328, 329, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 0, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352,
+    353, 354, 355, 356, 357, 358, 359, 360,
+  },
+  {
+    361, 362, 363, 364, 365, 366, 367, 368,
+    369, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 370,
+    0, 0, 371, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    372, 373, 374, 375, 376, 377, 378, 379,
+    380, 381, 382, 383, 384, 385, 386, 387,
+    388, 389, 390, 391, 392, 393, 394, 395,
+    396, 397, 398, 399, 400, 401, 402, 403,
+  },
+  {
+    404, 405, 406, 407, 408, 409, 410, 411,
+    412, 413, 414, 415, 416, 417, 418, 419,
+    420, 421, 422, 423, 424, 425, 426, 427,
+    428, 429, 430, 431, 432, 433, 434, 435,
+    436, 437, 438, 439, 440, 441, 442, 443,
+    444, 445, 446, 447, 448, 449, 450, 451,
+    452, 453, 454, 455, 456, 457, 458, 459,
+    460, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 461,
+    462, 463, 464, 465, 466, 467, 468, 469,
+    470, 471, 472, 473, 474, 475, 476, 477,
+    478, 479, 480, 481, 482, 483, 484, 485,
+    486, 487, 488, 489, 490, 491, 492, 493,
+    494, 0, 495, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 496, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    497, 498, 499, 500, 501, 502, 503, 504,
+    505, 506, 507, 508, 509, 510, 511, 512,
+    513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528,
+    529, 530, 531, 532, 533, 534, 535, 536,
+    537, 538, 539, 540, 541, 542, 543, 544,
+    545, 546, 547, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+  },
+};
+
@@ -2,6 +2,8 @@
 // Copyright 2010-11 Andy Koppe
 // Licensed under the terms of the GNU General Public License v3 or later.
 
+#include <time.h>
+
 void
 strset(string *sp, string s)
 {
@@ -51,6 +53,14 @@ asform(const char *fmt, ...)
   return s;
 }
 
+/* Microseconds from an arbitrary starting point, for timing things. */
+unsigned long long
+clock_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
 
 #if CYGWIN_VERSION_API_MINOR < 74
 int iswalnum(wint_t wc) { return wc < 0x100 && isalnum(wc); }
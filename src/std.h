@@ -41,6 +41,8 @@ int vasprintf(char **, const char *, va_list);
 
 char *asform(const char *fmt, ...);
 
+unsigned long long clock_us(void);
+
 #define WINVER 0x500  // Windows 2000
 #define _WIN32_WINNT WINVER
 #define _WIN32_IE WINVER
@@ -0,0 +1,121 @@
+// tabbench.cc (part of FaTTY)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+// Measures what a pass of the child loop costs per number of tabs, apart
+// from the actual reading and parsing: filling in the pollfd array, the
+// poll() itself, and going through the results, as in child_proc(). For
+// comparison, it also times the select() the loop used to do, as long as
+// the fds fit into an fd_set. Each synthetic tab is a pty with nothing
+// running on it, except that one of them has output waiting, so that
+// poll() has something to report. Not part of fatty itself:
+//
+//   make tabbench && ./tabbench [tabs...]
+
+#include <algorithm>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/select.h>
+#include <time.h>
+#include <unistd.h>
+
+struct Tab {
+    int pty_fd, slave_fd;
+};
+
+static const int passes = 20000;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool open_tab(Tab& tab) {
+    tab.pty_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (tab.pty_fd < 0)
+        return false;
+    char* name;
+    if (grantpt(tab.pty_fd) < 0 || unlockpt(tab.pty_fd) < 0 ||
+        !(name = ptsname(tab.pty_fd)) ||
+        (tab.slave_fd = open(name, O_RDWR | O_NOCTTY)) < 0) {
+        close(tab.pty_fd);
+        return false;
+    }
+    return true;
+}
+
+static double poll_pass(std::vector<Tab>& tabs) {
+    std::vector<struct pollfd> pollfds;
+    long ready = 0;
+    double start = now();
+    for (int p = 0; p < passes; p++) {
+        pollfds.resize(tabs.size());
+        for (size_t i = 0; i < tabs.size(); i++)
+            pollfds[i] = {tabs[i].pty_fd, POLLIN, 0};
+        poll(pollfds.data(), pollfds.size(), 0);
+        for (struct pollfd& pfd : pollfds)
+            ready += (pfd.revents & POLLIN) != 0;
+    }
+    double time = now() - start;
+    if (ready != passes)
+        fprintf(stderr, "poll: expected one ready tab per pass\n");
+    return time / passes;
+}
+
+static double select_pass(std::vector<Tab>& tabs) {
+    long ready = 0;
+    double start = now();
+    for (int p = 0; p < passes; p++) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        int highfd = 0;
+        for (Tab& tab : tabs) {
+            FD_SET(tab.pty_fd, &fds);
+            highfd = std::max(highfd, tab.pty_fd);
+        }
+        struct timeval timeout = {0, 0};
+        select(highfd + 1, &fds, 0, 0, &timeout);
+        for (Tab& tab : tabs)
+            ready += FD_ISSET(tab.pty_fd, &fds) != 0;
+    }
+    double time = now() - start;
+    if (ready != passes)
+        fprintf(stderr, "select: expected one ready tab per pass\n");
+    return time / passes;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<int> counts;
+    for (int i = 1; i < argc; i++)
+        counts.push_back(atoi(argv[i]));
+    if (counts.empty())
+        counts = {10, 100, 300, 1000};
+
+    printf("%6s %12s %12s\n", "tabs", "poll", "select");
+    for (int n : counts) {
+        std::vector<Tab> tabs(n);
+        int opened = 0;
+        while (opened < n && open_tab(tabs[opened]))
+            opened++;
+        if (opened < n) {
+            printf("%6d  only %d ptys could be opened\n", n, opened);
+            tabs.resize(opened);
+        }
+        else {
+            write(tabs[0].slave_fd, "x", 1);
+            printf("%6d %9.2f us", n, poll_pass(tabs) * 1e6);
+            if (tabs.back().pty_fd < FD_SETSIZE)
+                printf(" %9.2f us\n", select_pass(tabs) * 1e6);
+            else
+                printf(" %12s\n", "n/a");
+        }
+        for (Tab& tab : tabs) {
+            close(tab.slave_fd);
+            close(tab.pty_fd);
+        }
+    }
+}
@@ -26,16 +26,25 @@ static void
 tblink_cb(void* data)
 {
   struct term* term = (struct term*)data;
+  term->tblink_pending = false;
   term->tblinker = !term->tblinker;
   term_schedule_tblink(term);
-  win_update_term(term);
+  win_update_partial(term);
 }
 
+/*
+ * The timer only runs while there's blinking text on the display,
+ * as far as the last paint knows.
+ */
 void
 term_schedule_tblink(struct term* term)
 {
-  if (term->blink_is_real)
-    win_set_timer(tblink_cb, term, 500);
+  if (term->blink_is_real && term->has_focus && term->blink_lines) {
+    if (!term->tblink_pending) {
+      term->tblink_pending = true;
+      win_set_timer(tblink_cb, term, 500);
+    }
+  }
   else
     term->tblinker = 1;  /* reset when not in use */
 }
@@ -49,7 +58,7 @@ cblink_cb(void* data)
   struct term* term = (struct term*)data;
   term->cblinker = !term->cblinker;
   term_schedule_cblink(term);
-  win_update_term(term);
+  win_update_partial(term);
 }
 
 void
@@ -72,6 +81,10 @@ vbell_cb(void* data)
 void
 term_schedule_vbell(struct term* term, int already_started, int startpoint)
 {
+ /* Further bells during a flash don't prolong it. */
+  if (term->in_vbell && !already_started)
+    return;
+
   int ticks_gone = already_started ? get_tick_count() - startpoint : 0;
   int ticks = 100 - ticks_gone;
   if ((term->in_vbell = ticks > 0))
@@ -143,6 +156,9 @@ term_reset(struct term* term)
   term->cursor_type = -1;
   term->cursor_blinks = -1;
   term->blink_is_real = cfg.allow_blinking;
+  term->paint_flashing = cfg.paint_flashing;
+  term->flash_top = INT_MAX;
+  term->flash_bottom = -1;
   term->erase_char = basic_erase_char;
   term->on_alt_screen = false;
   term_print_finish(term);
@@ -176,7 +192,10 @@ static void freelines(termlines* lines, int rows) {
 void
 term_free(struct term* term)
 {
+  win_cancel_timers(term);
+
   freelines(term->displines, term->rows);
+  free(term->blinking);
   freelines(term->lines, term->rows);
   freelines(term->other_lines, term->rows);
 
@@ -189,23 +208,115 @@ term_free(struct term* term)
   free(term->tabs);
 
   free(term->paste_buffer);
+  free(term->paste_out);
+
+  if (term->other_packed) {
+    for (int i = 0; i < term->rows; i++)
+      free(term->other_packed[i]);
+    free(term->other_packed);
+  }
 
-  free(term->ltemp);
   free(term->wcFrom);
   free(term->wcTo);
-  for (int i = 0; i < term->bidi_cache_size; i++) {
-    free(term->pre_bidi_cache[i].chars);
-    free(term->pre_bidi_cache[i].forward);
-    free(term->pre_bidi_cache[i].backward);
-    free(term->post_bidi_cache[i].chars);
-    free(term->post_bidi_cache[i].forward);
-    free(term->post_bidi_cache[i].backward);
-  }
-  free(term->pre_bidi_cache);
-  free(term->post_bidi_cache);
+  term_bidi_cache_clear(term);
   memset(term, 0, sizeof(*term));
 }
 
+/* A display buffer where every cell needs painting. */
+static termlines *
+new_displines(int rows, int cols)
+{
+  termlines *lines = newn(termline *, rows);
+  for (int i = 0; i < rows; i++) {
+    termline *line = newline(cols, basic_erase_char);
+    lines[i] = line;
+    for (int j = 0; j < cols; j++) {
+      line->chars[j].attr = CATTR_DEFAULT;
+      line->chars[j].attr.attr = ATTR_INVALID;
+    }
+  }
+  return lines;
+}
+
+/*
+ * Drop what a terminal in a background tab only needs for being shown:
+ * the display buffer and bidi caches go, and the inactive screen is
+ * compressed like scrollback, or just remembered as its erase character
+ * if it's blank, which an unused alternate screen always is.
+ * Anything that needs them back calls term_wake().
+ */
+void
+term_hibernate(struct term* term)
+{
+  if (term->hibernating || !term->rows ||
+      term->show_other_screen || term->selected)
+    return;
+
+  freelines(term->displines, term->rows);
+  term->displines = null;
+  free(term->wcFrom);
+  free(term->wcTo);
+  term->wcFrom = term->wcTo = null;
+  term->wcFromTo_size = 0;
+  term_bidi_cache_clear(term);
+
+  termlines *lines = term->other_lines;
+  termchar *blank = &lines[0]->chars[0];
+  bool is_blank = true;
+  for (int i = 0; i < term->rows && is_blank; i++) {
+    termline *line = lines[i];
+    if (line->attr != LATTR_NORM)
+      is_blank = false;
+    for (int j = 0; j < line->cols && is_blank; j++)
+      is_blank = termchars_equal(&line->chars[j], blank);
+  }
+  if (is_blank) {
+    term->other_blank = *blank;
+    term->other_blank.cc_next = 0;
+  }
+  else {
+    term->other_packed = newn(uchar *, term->rows);
+    for (int i = 0; i < term->rows; i++)
+      term->other_packed[i] = compressline(lines[i]);
+  }
+  freelines(lines, term->rows);
+  term->other_lines = null;
+
+  if (term->child)
+    child_release_ring(term->child);
+
+  term->hibernating = true;
+}
+
+void
+term_wake(struct term* term)
+{
+  if (!term->hibernating)
+    return;
+  term->hibernating = false;
+
+  term->displines = new_displines(term->rows, term->cols);
+
+  termlines *lines = newn(termline *, term->rows);
+  for (int i = 0; i < term->rows; i++) {
+    if (term->other_packed) {
+      lines[i] = decompressline(term->other_packed[i], null);
+      lines[i]->temporary = false;
+      free(term->other_packed[i]);
+    }
+    else
+      lines[i] = newline(term->cols, term->other_blank);
+  }
+  free(term->other_packed);
+  term->other_packed = null;
+  term->other_lines = lines;
+
+  // Woken in the background, such as by output switching screens, so it
+  // should go back to sleep in due course.
+  if (term != win_active_terminal())
+    win_schedule_hibernate();
+}
+
 static void
 show_screen(struct term* term, bool other_screen)
 {
@@ -270,6 +381,7 @@ scrollback_push(struct term* term, uchar *line)
     }
     else if (term->sblines) {
       // Throw away the oldest line
+      term->sbbytes -= compressed_size(term->scrollback[term->sbpos]);
       free(term->scrollback[term->sbpos]);
       term->sblines--;
     }
@@ -279,6 +391,8 @@ scrollback_push(struct term* term, uchar *line)
   assert(term->sblines < term->sblen);
   assert(term->sbpos < term->sblen);
   term->scrollback[term->sbpos++] = line;
+  term->sbbytes += compressed_size(line);
+  term->stats.compressed++;
   if (term->sbpos == term->sblen)
     term->sbpos = 0;
   term->sblines++;
@@ -296,7 +410,9 @@ scrollback_pop(struct term* term)
     term->tempsblines--;
   if (term->sbpos == 0)
     term->sbpos = term->sblen;
-  return term->scrollback[--term->sbpos];
+  uchar *line = term->scrollback[--term->sbpos];
+  term->sbbytes -= compressed_size(line);
+  return line;
 }
 
 /*
@@ -320,6 +436,16 @@ term_clear_scrollback(struct term* term)
 void
 term_resize(struct term* term, int newrows, int newcols)
 {
+ /*
+  * A hibernating terminal needn't wake up for this: the alternate screen
+  * is started afresh anyway, and there are no displines to resize.
+  * Only if the alternate screen is showing is the main one needed back,
+  * and then the terminal goes back to sleep afterwards.
+  */
+  bool hibernating = term->hibernating;
+  if (term->on_alt_screen)
+    term_wake(term);
+
   bool on_alt_screen = term->on_alt_screen;
   term_switch_screen(term, 0, false);
 
@@ -411,29 +537,35 @@ term_resize(struct term* term, int newrows, int newcols)
     resizeline(lines[i], newcols);
 
   // Make a new displayed text buffer.
-  if (term->displines) {
-    for (int i = 0; i < term->rows; i++)
-      freeline(term->displines[i]);
-  }
-  term->displines = renewn(term->displines, newrows);
-  for (int i = 0; i < newrows; i++) {
-    termline *line = newline(newcols, basic_erase_char);
-    term->displines[i] = line;
-    for (int j = 0; j < newcols; j++) {
-      line->chars[j].attr = CATTR_DEFAULT;
-      line->chars[j].attr.attr = ATTR_INVALID;
-    }
+  if (!term->hibernating) {
+    freelines(term->displines, term->rows);
+    term->displines = new_displines(newrows, newcols);
   }
+  term->blinking = renewn(term->blinking, newrows);
+  memset(term->blinking, 0, newrows * sizeof(bool));
+  term->blink_lines = 0;
 
   // Make a new alternate screen.
-  lines = term->other_lines;
-  if (lines) {
-    for (int i = 0; i < term->rows; i++)
-      freeline(lines[i]);
+  if (term->hibernating) {
+    if (term->other_packed) {
+      for (int i = 0; i < term->rows; i++)
+        free(term->other_packed[i]);
+      free(term->other_packed);
+      term->other_packed = null;
+    }
+    term->other_blank = term->erase_char;
+    term->other_blank.cc_next = 0;
+  }
+  else {
+    lines = term->other_lines;
+    if (lines) {
+      for (int i = 0; i < term->rows; i++)
+        freeline(lines[i]);
+    }
+    term->other_lines = lines = renewn(lines, newrows);
+    for (int i = 0; i < newrows; i++)
+      lines[i] = newline(newcols, term->erase_char);
   }
-  term->other_lines = lines = renewn(lines, newrows);
-  for (int i = 0; i < newrows; i++)
-    lines[i] = newline(newcols, term->erase_char);
 
   // Reset tab stops
   term->tabs = renewn(term->tabs, newcols);
@@ -453,6 +585,8 @@ term_resize(struct term* term, int newrows, int newcols)
   term->cols = newcols;
 
   term_switch_screen(term, on_alt_screen, false);
+  if (hibernating)
+    term_hibernate(term);
 }
 
 /*
@@ -467,6 +601,7 @@ term_switch_screen(struct term* term, bool to_alt, bool reset)
   if (to_alt == term->on_alt_screen)
     return;
 
+  term_wake(term);
   term->on_alt_screen = to_alt;
 
   termlines *oldlines = term->lines;
@@ -522,6 +657,7 @@ term_check_boundary(struct term* term, int x, int y)
 void
 term_do_scroll(struct term* term, int topline, int botline, int lines, bool sb)
 {
+  trace_scope("term_do_scroll");
   assert(botline >= topline && lines != 0);
 
   bool down = lines < 0; // Scrolling downwards?
@@ -533,6 +669,8 @@ term_do_scroll(struct term* term, int topline, int botline, int lines, bool sb)
   int lines_in_region = botline - topline;
   lines = min(lines, lines_in_region);
 
+  term->stats.scrolled += lines;
+
   // Number of lines that are moved up or down as they are.
   // The rest are scrolled out of the region and replaced by empty lines.
   int moved_lines = lines_in_region - lines;
@@ -664,28 +802,134 @@ term_erase(struct term* term, bool selective, bool line_only, bool from_begin, b
   }
 }
 
+/* Draw a run of text, counting it and flashing it if asked to. */
+static void
+paint_text(struct term* term, int x, int y, wchar *text, int len,
+           cattr attr, int lattr)
+{
+  term->stats.runs++;
+  win_text(x, y, text, len, attr, lattr);
+  if (term->paint_flashing) {
+    if (y != term->frame_last_row) {
+      term->frame_rows++;
+      term->frame_last_row = y;
+    }
+    term->frame_cells += len * (attr.attr & ATTR_WIDE ? 2 : 1);
+    if (!term->flash_clearing) {
+      win_flash_run(x, y, len, attr, lattr, term->flash_frame);
+      term->flash_top = min(term->flash_top, y);
+      term->flash_bottom = max(term->flash_bottom, y);
+    }
+  }
+}
+
+static void
+flash_clear_cb(void *data)
+{
+  struct term* term = data;
+  term->flash_pending = false;
+  term->flash_clearing = true;
+  term_invalidate(term, 0, term->flash_top, term->cols - 1, term->flash_bottom);
+  term->flash_top = INT_MAX;
+  term->flash_bottom = -1;
+  win_update_term(term);
+}
+
+static void
+flash_start(struct term* term)
+{
+  term->frame_rows = term->frame_cells = 0;
+  term->frame_last_row = -1;
+}
+
+static void
+flash_finish(struct term* term)
+{
+  // The repaint that takes the outlines away doesn't count as a frame.
+  if (!term->flash_clearing && term->frame_cells) {
+    term->flash_rows = term->frame_rows;
+    term->flash_cells = term->frame_cells;
+    term->flash_frame++;
+    if (!term->flash_pending) {
+      term->flash_pending = true;
+      win_set_timer(flash_clear_cb, term, 250);
+    }
+  }
+  term->flash_clearing = false;
+  win_flash_info(term->cols, term->flash_rows, term->flash_cells);
+}
+
 void
-term_paint(struct term* term)
+term_set_paint_flashing(struct term* term, bool on)
+{
+  if (on == term->paint_flashing)
+    return;
+  term->paint_flashing = on;
+  term->flash_top = INT_MAX;
+  term->flash_bottom = -1;
+  term->flash_rows = term->flash_cells = 0;
+  // Get rid of outlines and the counters.
+  term_invalidate(term, 0, 0, term->cols - 1, term->rows - 1);
+  win_update_term(term);
+}
+
+static void
+record_latency(struct term* term, unsigned long long us)
 {
+  term_latency *lat = &term->latency;
+  lat->count++;
+  lat->total_us += us;
+  lat->max_us = max(lat->max_us, us);
+  uint i = 0;
+  while (i < LATENCY_BUCKETS - 1 && us >= 1000ull << i)
+    i++;
+  lat->buckets[i]++;
+}
+
+/*
+ * Update the display. If partial is set, only the lines the cursor
+ * was last painted on and is on now, and lines with blinking text,
+ * are looked at. That's for when nothing else has changed since the
+ * last paint, such as when the cursor or text blinks, and saves
+ * diffing the whole screen.
+ */
+static void
+paint(struct term* term, bool partial)
+{
+  if (term->hibernating)
+    return;
+
+  trace_scope("term_paint");
+  unsigned long long start_us = clock_us();
+  term->stats.paints++;
+  if (term->paint_flashing)
+    flash_start(term);
+
  /* The display line that the cursor is on, or -1 if the cursor is invisible. */
   int curs_y =
     term->cursor_on && !term->show_other_screen
     ? term->curs.y - term->disptop : -1;
+  int old_curs_y = term->painted_curs_y;
 
   for (int i = 0; i < term->rows; i++) {
+    if (partial && i != curs_y && i != old_curs_y && !term->blinking[i])
+      continue;
+
     pos scrpos;
     scrpos.y = i + term->disptop;
 
    /* Do Arabic shaping and bidi. */
     termline *line = fetch_line(term, scrpos.y);
-    termchar *chars = term_bidi_line(term, line, i);
-    int *backward = chars ? term->post_bidi_cache[i].backward : 0;
-    int *forward = chars ? term->post_bidi_cache[i].forward : 0;
-    chars = chars ?: line->chars;
+    bidi_cache_entry *bidi = term_bidi_line(term, line);
+    termchar *chars = bidi ? bidi->after : line->chars;
+    int *backward = bidi ? bidi->backward : 0;
+    int *forward = bidi ? bidi->forward : 0;
 
     termline *displine = term->displines[i];
     termchar *dispchars = displine->chars;
     termchar newchars[term->cols];
+    bool blinking = false;
+    term->stats.cells += term->cols;
 
   /*
     * First loop: work along the line deciding what we want
@@ -718,6 +962,7 @@ term_paint(struct term* term)
 
      /* 'Real' blinking ? */
       if (term->blink_is_real && (tattr.attr & ATTR_BLINK)) {
+        blinking = true;
         if (term->has_focus && term->tblinker)
           tchar = ' ';
         tattr.attr &= ~ATTR_BLINK;
@@ -742,6 +987,9 @@ term_paint(struct term* term)
       newchars[j].cc_next = 0;
     }
 
+    term->blink_lines += blinking - term->blinking[i];
+    term->blinking[i] = blinking;
+
     if (i == curs_y) {
      /* Determine the column the cursor is on, taking bidi into account and
       * moving it one column to the left when it's on the right half of a
@@ -840,7 +1088,7 @@ term_paint(struct term* term)
 
       if (break_run) {
         if (dirty_run && textlen)
-          win_text(start, i, text, textlen, attr, line->attr);
+          paint_text(term, start, i, text, textlen, attr, line->attr);
         start = j;
         textlen = 0;
         attr = tattr;
@@ -885,16 +1133,176 @@ term_paint(struct term* term)
       }
     }
     if (dirty_run && textlen)
-      win_text(start, i, text, textlen, attr, line->attr);
+      paint_text(term, start, i, text, textlen, attr, line->attr);
     release_line(line);
   }
 
+  term->painted_curs_y = curs_y;
   term->cursor_invalid = false;
+  term_schedule_tblink(term);
+  unsigned long long end_us = clock_us();
+  term->stats.paint_us += end_us - start_us;
+  if (term->paint_flashing)
+    flash_finish(term);
+  if (term->key_us && term->key_answered) {
+    record_latency(term, end_us - term->key_us);
+    term->key_us = 0;
+    term->key_answered = false;
+  }
+}
+
+/*
+ * Format the counters as a list of name=value pairs separated by
+ * semicolons, as reported by OSC 7772, followed by the child loop's
+ * parsing slice counters. Returns the length, like snprintf().
+ */
+int
+term_format_stats(struct term* term, char *buf, uint size)
+{
+  term_stats *st = &term->stats;
+  struct child *child = term->child;
+  return snprintf(buf, size,
+    "bytes=%llu;chars=%llu;ctrls=%llu;escs=%llu;csis=%llu;cmds=%llu;"
+    "scrolled=%llu;compressed=%llu;sblines=%d;sbbytes=%llu;"
+    "paints=%llu;cells=%llu;runs=%llu;write_us=%llu;paint_us=%llu;"
+    "slices=%u;slices_exhausted=%u;slice_us=%llu;bytes_parsed=%llu",
+    st->bytes, st->chars, st->ctrls, st->escs, st->csis, st->cmds,
+    st->scrolled, st->compressed, term->sblines, term->sbbytes,
+    st->paints, st->cells, st->runs, st->write_us, st->paint_us,
+    child ? child->slices : 0, child ? child->slices_exhausted : 0,
+    child ? child->slice_us : 0, child ? child->bytes_parsed : 0);
+}
+
+void
+term_reset_stats(struct term* term)
+{
+  term->stats = (term_stats){0};
+  struct child *child = term->child;
+  if (child) {
+    child->slices = child->slices_exhausted = 0;
+    child->slice_us = child->bytes_parsed = 0;
+  }
+}
+
+/*
+ * Note a keystroke sent to the child. If one is still waiting for its
+ * response to be painted, that's kept, as it's been waiting longer,
+ * unless it's gone unanswered for too long.
+ */
+void
+term_keystroke(struct term* term)
+{
+  unsigned long long now = clock_us();
+  if (!term->key_us ||
+      (!term->key_answered && now - term->key_us >= KEY_TIMEOUT_US)) {
+    term->key_us = now;
+    term->key_answered = false;
+  }
+}
+
+/*
+ * Format the keystroke latencies as reported by OSC 7774: the number of
+ * samples, their mean and maximum in microseconds, and the histogram,
+ * with each bucket named after its upper bound. Returns the length, like
+ * snprintf().
+ */
+int
+term_format_latency(struct term* term, char *buf, uint size)
+{
+  term_latency *lat = &term->latency;
+  int len = snprintf(buf, size, "count=%llu;mean_us=%llu;max_us=%llu",
+                     lat->count, lat->count ? lat->total_us / lat->count : 0,
+                     lat->max_us);
+  for (int i = 0; i < LATENCY_BUCKETS; i++) {
+    uint pos = min((uint)len, size);
+    if (i < LATENCY_BUCKETS - 1)
+      len += snprintf(buf + pos, size - pos, ";lt%ums=%u", 1u << i,
+                      lat->buckets[i]);
+    else
+      len += snprintf(buf + pos, size - pos, ";more=%u", lat->buckets[i]);
+  }
+  return len;
+}
+
+static size_t
+lines_memory(termlines *lines, int rows)
+{
+  if (!lines)
+    return 0;
+  size_t size = rows * sizeof(termline *);
+  for (int i = 0; i < rows; i++)
+    size += sizeof(termline) + lines[i]->size * sizeof(termchar);
+  return size;
+}
+
+void
+term_get_memory(struct term* term, term_memory *mem)
+{
+  int rows = term->rows;
+  mem->lines = lines_memory(term->lines, rows);
+  mem->other_lines = lines_memory(term->other_lines, rows);
+  if (term->other_packed) {
+    mem->other_lines += rows * sizeof(uchar *);
+    for (int i = 0; i < rows; i++)
+      mem->other_lines += compressed_size(term->other_packed[i]);
+  }
+  mem->displines = lines_memory(term->displines, rows);
+  mem->scrollback = term->sbbytes;
+  mem->scrollback_index = term->sblen * sizeof(uchar *);
+
+  mem->bidi = 2 * term->wcFromTo_size * sizeof(bidi_char);
+  mem->bidi += term->bidi_cache_size * (sizeof(bidi_cache_entry) + sizeof(int));
+  for (int i = 0; i < term->bidi_cache_size; i++) {
+    bidi_cache_entry *e = &term->bidi_cache[i];
+    mem->bidi += e->capacity * (2 * sizeof(termchar) + 2 * sizeof(int));
+  }
+
+  mem->buffers = term->inbuf_size + term->printbuf_size;
+  if (term->paste_buffer)
+    mem->buffers += term->paste_len * sizeof(wchar) + PASTE_CHUNK * cs_cur_max;
+  struct child *child = term->child;
+  if (child)
+    mem->buffers += child->ring_size + child->out_size;
+
+  mem->total =
+    mem->lines + mem->other_lines + mem->displines + mem->scrollback +
+    mem->scrollback_index + mem->bidi + mem->buffers;
+}
+
+/*
+ * Format the memory use as name=value pairs separated by semicolons, as
+ * reported by OSC 7773. Returns the length, like snprintf().
+ */
+int
+term_format_memory(struct term* term, char *buf, uint size)
+{
+  term_memory mem;
+  term_get_memory(term, &mem);
+  return snprintf(buf, size,
+    "lines=%zu;other_lines=%zu;displines=%zu;scrollback=%zu;sblines=%d;"
+    "sbindex=%zu;bidi=%zu;buffers=%zu;total=%zu",
+    mem.lines, mem.other_lines, mem.displines, mem.scrollback, term->sblines,
+    mem.scrollback_index, mem.bidi, mem.buffers, mem.total);
+}
+
+void
+term_paint(struct term* term)
+{
+  paint(term, false);
+}
+
+void
+term_paint_partial(struct term* term)
+{
+  paint(term, true);
 }
 
 void
 term_invalidate(struct term* term, int left, int top, int right, int bottom)
 {
+  if (term->hibernating)
+    return;
+
   if (left < 0)
     left = 0;
   if (top < 0)
@@ -938,21 +1346,35 @@ term_set_focus(struct term* term, bool has_focus)
 {
   if (has_focus != term->has_focus) {
     term->has_focus = has_focus;
+    // A keystroke's answer won't be painted while we're in the background.
+    if (!has_focus)
+      term->key_us = 0;
     term_schedule_cblink(term);
+    term_schedule_tblink(term);
     if (term->report_focus)
       child_write(term->child, has_focus ? "\e[I" : "\e[O", 3);
   }
 }
 
+/*
+ * The charset mode is global, but terminals each have their own, so
+ * this needs calling before converting anything for a terminal.
+ */
 void
 term_update_cs(struct term* term)
 {
   term_cursor *curs = &term->curs;
-  cs_set_mode(
+  cs_mode mode =
     curs->oem_acs ? CSM_OEM :
     curs->utf ? CSM_UTF8 :
-    curs->csets[curs->g1] == CSET_OEM ? CSM_OEM : CSM_DEFAULT
-  );
+    curs->csets[curs->g1] == CSET_OEM ? CSM_OEM : CSM_DEFAULT;
+  if (mode != term->cs_mode || term->cs_locale_id != cs_locale_id) {
+    term->cs_mode = mode;
+    term->cs_locale_id = cs_locale_id;
+    cs_mb1towc(&term->mb_state, 0, 0);
+    term->in_mb_char = false;
+  }
+  cs_set_mode(mode);
 }
 
 int
@@ -972,6 +1394,6 @@ term_hide_cursor(struct term* term)
 {
   if (term->cursor_on) {
     term->cursor_on = false;
-    win_update_term(term);
+    win_update_partial(term);
   }
 }
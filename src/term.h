@@ -3,10 +3,12 @@
 
 #include "minibidi.h"
 #include "config.h"
+#include "charset.h"
 
 // Colour numbers
 
 struct term;
+struct Tab;
 
 typedef enum {
   // ANSI colours
@@ -174,8 +176,14 @@ typedef struct {
 typedef termline *termlines;
 
 typedef struct {
-  int width;
-  termchar *chars;
+  uint hash;            /* hash of the line content */
+  int next;             /* next entry in the same hash bucket, or -1 */
+  unsigned long long last_used;  /* LRU stamp, 0 if unused */
+  int width;            /* number of columns */
+  int size;             /* number of termchars, including cc-lists */
+  int capacity;         /* number of termchars allocated */
+  termchar *before;     /* the line as fed to the bidi algorithm */
+  termchar *after;      /* the line after bidi and shaping */
   int *forward, *backward;      /* the permutations of line positions */
 } bidi_cache_entry;
 
@@ -198,9 +206,11 @@ void add_cc(termline *, int col, wchar chr);
 void clear_cc(termline *, int col);
 
 uchar *compressline(termline *);
+uint compressed_size(uchar *);
 termline *decompressline(uchar *, int *bytes_used);
 
-termchar *term_bidi_line(struct term* term, termline *, int scr_y);
+bidi_cache_entry *term_bidi_line(struct term* term, termline *);
+void term_bidi_cache_clear(struct term* term);
 
 /* Traditional terminal character sets */
 typedef enum {
@@ -235,6 +245,49 @@ typedef struct {
   uchar oem_acs;
 } term_cursor;
 
+/* Counters of what a terminal has been doing, for diagnostics. */
+typedef struct {
+  unsigned long long bytes;       /* input processed */
+  unsigned long long chars;       /* characters written to the screen */
+  unsigned long long ctrls;       /* control characters */
+  unsigned long long escs;        /* escape sequences other than below */
+  unsigned long long csis;        /* control sequences */
+  unsigned long long cmds;        /* OSC and DCS command strings */
+  unsigned long long scrolled;    /* lines scrolled */
+  unsigned long long compressed;  /* lines compressed into scrollback */
+  unsigned long long paints;
+  unsigned long long cells;       /* cells compared with the display */
+  unsigned long long runs;        /* text runs drawn */
+  unsigned long long write_us;    /* time spent in term_write() */
+  unsigned long long paint_us;    /* time spent painting */
+} term_stats;
+
+/*
+ * Time from a keystroke to the end of the first paint after the child has
+ * responded to it. Bucket i counts latencies below 2^i milliseconds, and
+ * the last bucket the rest. Keystrokes without output within
+ * KEY_TIMEOUT_US, or before the terminal loses focus, aren't counted.
+ */
+enum { LATENCY_BUCKETS = 12, KEY_TIMEOUT_US = 1000000 };
+typedef struct {
+  unsigned long long count;
+  unsigned long long total_us;
+  unsigned long long max_us;
+  uint buckets[LATENCY_BUCKETS];
+} term_latency;
+
+/* Memory used by a terminal, in bytes. */
+typedef struct {
+  size_t lines;           /* screen, including combining character overflow */
+  size_t other_lines;     /* inactive screen, compressed while hibernating */
+  size_t displines;
+  size_t scrollback;      /* compressed scrollback lines */
+  size_t scrollback_index;
+  size_t bidi;            /* bidi cache and work buffers */
+  size_t buffers;         /* input, paste and printer buffers, child queues */
+  size_t total;
+} term_memory;
+
 struct term {
   bool on_alt_screen;     /* On alternate screen? */
   bool show_other_screen;
@@ -250,6 +303,7 @@ struct term {
   int tempsblines;        /* number of lines of .scrollback that
                            * can be retrieved onto the terminal
                            * ("temporary scrollback") */
+  unsigned long long sbbytes;  /* size of the compressed scrollback */
 
   termlines *displines;   /* buffer of text on real screen */
 
@@ -264,6 +318,7 @@ struct term {
   bool reset_132;        /* Flag ESC c resets to 80 cols */
   bool cblinker; /* When blinking is the cursor on ? */
   bool tblinker; /* When the blinking text is on */
+  bool tblink_pending;   /* Text blink timer running */
   bool blink_is_real;    /* Actually blink blinking text */
   bool echoing;  /* Does terminal want local echo? */
   bool insert;   /* Insert mode */
@@ -298,6 +353,9 @@ struct term {
   int  cursor_type;
   int  cursor_blinks;
   bool cursor_invalid;
+  int  painted_curs_y;  /* display line the cursor was last painted on */
+  bool *blinking;       /* display lines painted with blinking text */
+  int  blink_lines;     /* number of those */
 
   uchar esc_mod;  // Modifier character in escape sequences
 
@@ -349,9 +407,16 @@ struct term {
 
   wchar *paste_buffer;
   int paste_len, paste_pos;
+  char *paste_out;      /* encoded chunk of the paste not yet written */
+  int paste_out_len, paste_out_pos;
+  bool paste_bracketed;  /* paste started with a bracket */
+  int paste_start_left;  /* bytes of the start bracket not yet written */
 
  /* True when we've seen part of a multibyte input char */
   bool in_mb_char;
+  cs_mbstate mb_state;
+  cs_mode cs_mode;
+  uint cs_locale_id;    /* locale that mb_state is for, see charset.c */
 
  /* Non-zero when we've seen the first half of a surrogate pair */
   wchar high_surrogate;
@@ -359,14 +424,47 @@ struct term {
  /*
   * These are buffers used by the bidi and Arabic shaping code.
   */
-  termchar *ltemp;
-  int ltemp_size;
   bidi_char *wcFrom, *wcTo;
   int wcFromTo_size;
-  bidi_cache_entry *pre_bidi_cache, *post_bidi_cache;
+  bidi_cache_entry *bidi_cache;
+  int *bidi_cache_buckets;
   int bidi_cache_size;
+  unsigned long long bidi_cache_clock;
 
   struct child* child;
+  struct Tab* tab;      /* the tab showing this terminal */
+
+ /*
+  * While hibernating there are no displines, and the inactive screen is
+  * held in other_packed, or is all other_blank if that's null.
+  */
+  bool hibernating;
+  uchar **other_packed;
+  termchar other_blank;
+
+  term_stats stats;
+
+ /*
+  * Keystroke whose response hasn't been painted yet, or 0, and whether
+  * there has been any output since.
+  */
+  unsigned long long key_us;
+  bool key_answered;
+  term_latency latency;
+
+ /*
+  * Paint flashing: runs drawn are outlined, in a colour that changes with
+  * each frame, until the rows between flash_top and flash_bottom are
+  * repainted without outlines a moment later. The rows and cells drawn
+  * by the last frame are shown in a corner.
+  */
+  bool paint_flashing;
+  bool flash_pending, flash_clearing;
+  uint flash_frame;
+  int flash_top, flash_bottom;
+  int frame_last_row;
+  uint frame_rows, frame_cells;
+  uint flash_rows, flash_cells;
 };
 
 
@@ -374,6 +472,15 @@ void term_resize(struct term* term, int, int);
 void term_scroll(struct term* term, int, int);
 void term_reset(struct term* term);
 void term_free(struct term* term);
+void term_hibernate(struct term* term);
+int term_format_stats(struct term* term, char *buf, uint size);
+void term_reset_stats(struct term* term);
+void term_get_memory(struct term* term, term_memory *);
+int term_format_memory(struct term* term, char *buf, uint size);
+void term_keystroke(struct term* term);
+void term_set_paint_flashing(struct term* term, bool on);
+int term_format_latency(struct term* term, char *buf, uint size);
+void term_wake(struct term* term);
 void term_clear_scrollback(struct term* term);
 void term_mouse_click(struct term* term, mouse_button, mod_keys, pos, int count);
 void term_mouse_release(struct term* term, mouse_button, mod_keys, pos);
@@ -381,16 +488,18 @@ void term_mouse_move(struct term* term, mod_keys, pos);
 void term_mouse_wheel(struct term* term, int delta, int lines_per_notch, mod_keys, pos);
 void term_select_all(struct term* term);
 void term_paint(struct term* term);
+void term_paint_partial(struct term* term);
 void term_invalidate(struct term* term, int left, int top, int right, int bottom);
 void term_open(struct term* term);
 void term_copy(struct term* term);
-void term_paste(struct term* term, wchar *, uint len);
+void term_paste(struct term* term, wchar *, uint len);  // takes the data
 void term_send_paste(struct term* term);
 void term_cancel_paste(struct term* term);
 void term_reconfig(struct term* term);
 void term_flip_screen(struct term* term);
 void term_reset_screen(struct term* term);
 void term_write(struct term* term, const char *, uint len);
+void term_update_cs(struct term* term);
 void term_flush(struct term* term);
 void term_set_focus(struct term* term, bool has_focus);
 int  term_cursor_type(struct term* term);
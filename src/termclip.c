@@ -167,26 +167,48 @@ term_open(struct term* term)
     free(buf.textbuf);
 }
 
+/*
+ * Pasting is done in chunks whenever the pty can take more, so that
+ * big pastes neither block the UI nor flood the pty. Each chunk is
+ * encoded into paste_out when the previous one has been written out.
+ *
+ * The data, which must have been allocated with newn(), becomes the paste
+ * buffer. The clipboard can't be kept open while the paste goes out, so
+ * the caller's copy of the text is needed, but nothing more than that
+ * and one encoded chunk.
+ */
 void
 term_paste(struct term* term, wchar *data, uint len)
 {
   term_cancel_paste(term);
 
-  term->paste_buffer = newn(wchar, len);
+  term->paste_buffer = data;
   term->paste_len = term->paste_pos = 0;
+  term->paste_out = newn(char, PASTE_CHUNK * cs_cur_max);
+  term->paste_out_len = term->paste_out_pos = 0;
 
-  // Copy data to the paste buffer, converting both Windows-style \r\n and
-  // Unix-style \n line endings to \r, because that's what the Enter key sends.
+  // Convert both Windows-style \r\n and Unix-style \n line endings to \r,
+  // because that's what the Enter key sends. That only ever makes the
+  // text shorter, so it's done in place.
+  wchar prev = 0;
   for (uint i = 0; i < len; i++) {
     wchar wc = data[i];
     if (wc != '\n')
-      term->paste_buffer[term->paste_len++] = wc;
-    else if (i == 0 || data[i - 1] != '\r')
-      term->paste_buffer[term->paste_len++] = '\r';
+      data[term->paste_len++] = wc;
+    else if (prev != '\r')
+      data[term->paste_len++] = '\r';
+    prev = wc;
   }
-  
-  if (term->bracketed_paste)
-    child_write(term->child, "\e[200~", 6);
+
+  // The start of a bracketed paste goes through the paste buffer too,
+  // so that it can't overtake pasted data.
+  term->paste_bracketed = term->bracketed_paste;
+  term->paste_start_left = 0;
+  if (term->paste_bracketed) {
+    memcpy(term->paste_out, "\e[200~", 6);
+    term->paste_out_len = term->paste_start_left = 6;
+  }
+  term_reset_screen(term);
   term_send_paste(term);
 }
 
@@ -195,22 +217,63 @@ term_cancel_paste(struct term* term)
 {
   if (term->paste_buffer) {
     free(term->paste_buffer);
+    free(term->paste_out);
     term->paste_buffer = 0;
-    if (term->bracketed_paste)
+    term->paste_out = 0;
+    win_tab_paste_progress(term);
+    // Only end the paste if its start has got out, at least in part.
+    int sent = 6 - term->paste_start_left;
+    if (term->paste_bracketed && sent) {
+      if (sent < 6)
+        child_write(term->child, "\e[200~" + sent, 6 - sent);
       child_write(term->child, "\e[201~", 6);
+    }
   }
 }
 
+/*
+ * Send as much of the paste as the pty takes without blocking.
+ * Called again by the child loop when the pty becomes writable.
+ */
 void
 term_send_paste(struct term* term)
 {
-  int i = term->paste_pos;
-  while (i < term->paste_len && term->paste_buffer[i++] != '\r');
-  child_sendw(term->child, term->paste_buffer + term->paste_pos, i - term->paste_pos);
-  if (i < term->paste_len)
-    term->paste_pos = i;
-  else
-    term_cancel_paste(term);
+  int progress = term->paste_pos * 100LL / max(term->paste_len, 1);
+
+  // Limit how much is sent in one go, to keep processing output.
+  for (int chunks = 16; chunks--;) {
+    if (term->paste_out_pos == term->paste_out_len) {
+      int n = min(term->paste_len - term->paste_pos, PASTE_CHUNK);
+      if (!n) {
+        term_cancel_paste(term);
+        return;
+      }
+      term_update_cs(term);
+      wchar *ws = term->paste_buffer + term->paste_pos;
+      if (n > 1 && is_high_surrogate(ws[n - 1]))
+        n--;
+      int len = cs_wcntombn(term->paste_out, ws, PASTE_CHUNK * cs_cur_max, n);
+      term->paste_pos += n;
+      term->paste_out_pos = 0;
+      term->paste_out_len = max(len, 0);
+      if (term->echoing)
+        term_write(term, term->paste_out, term->paste_out_len);
+    }
+
+    int len = term->paste_out_len - term->paste_out_pos;
+    int n = child_write_some(term->child, term->paste_out + term->paste_out_pos, len);
+    if (n < 0) {
+      term_cancel_paste(term);
+      return;
+    }
+    term->paste_out_pos += n;
+    term->paste_start_left = max(0, term->paste_start_left - n);
+    if (n < len)
+      break;
+  }
+
+  if (term->paste_pos * 100LL / max(term->paste_len, 1) != progress)
+    win_tab_paste_progress(term);
 }
 
 void
@@ -513,10 +513,17 @@ makerle(struct buf *b, termline *line,
 uchar *
 compressline(termline *line)
 {
+  trace_scope("compressline");
   struct buf buffer = { null, 0, 0 }, *b = &buffer;
 
  /*
-  * First, store the column count, 7 bits at a time, least
+  * Leave room for the total size, filled in at the end.
+  */
+  for (uint i = 0; i < sizeof(uint); i++)
+    add(b, 0);
+
+ /*
+  * Then store the column count, 7 bits at a time, least
   * significant `digit' first, with the high bit set on all but
   * the last.
   */
@@ -558,12 +565,24 @@ compressline(termline *line)
   makerle(b, line, makeliteral_attr);
   makerle(b, line, makeliteral_cc);
 
+  uint len = b->len;
+  memcpy(b->data, &len, sizeof len);
+
  /*
   * Trim the allocated memory so we don't waste any, and return.
   */
   return renewn(b->data, b->len);
 }
 
+/* Size of a compressed line, in bytes. */
+uint
+compressed_size(uchar *data)
+{
+  uint len;
+  memcpy(&len, data, sizeof len);
+  return len;
+}
+
 static void
 readrle(struct buf *b, termline *line,
         void (*readliteral) (struct buf *b, termchar *c, termline *line))
@@ -607,7 +626,7 @@ decompressline(uchar *data, int *bytes_used)
   termline *line;
 
   b->data = data;
-  b->len = 0;
+  b->len = sizeof(uint);  /* skip the size */
 
  /*
   * First read in the column count.
@@ -773,138 +792,194 @@ release_line(termline *line)
 }
 
 
+
 /*
  * To prevent having to run the reasonably tricky bidi algorithm
- * too many times, we maintain a cache of the last lineful of data
- * fed to the algorithm on each line of the display.
+ * too many times, we maintain a cache of lines fed to the algorithm.
+ * It is keyed by line content rather than by screen row, so entries
+ * are still good after the screen scrolls. The cache is a bounded
+ * LRU: when it is full, the least recently used entry is recycled,
+ * along with its buffers.
  */
-static int
-term_bidi_cache_hit(struct term* term, int line, termchar *lbefore, int width)
-{
-  int i;
-
-  if (!term->pre_bidi_cache)
-    return false;       /* cache doesn't even exist yet! */
 
-  if (line >= term->bidi_cache_size)
-    return false;       /* cache doesn't have this many lines */
+enum { BIDI_CACHE_MIN = 32 };
 
-  if (!term->pre_bidi_cache[line].chars)
-    return false;       /* cache doesn't contain _this_ line */
-
-  if (term->pre_bidi_cache[line].width != width)
-    return false;       /* line is wrong width */
-
-  for (i = 0; i < width; i++)
-    if (!termchars_equal(term->pre_bidi_cache[line].chars + i, lbefore + i))
-      return false;     /* line doesn't match cache */
-
-  return true;  /* it didn't match. */
+static uint
+bidi_hash(termchar *chars, int width)
+{
+ /* FNV-1a over the fields termchars_equal() compares, apart from
+    combining characters, which are left to the full comparison. */
+  uint h = 2166136261u ^ width;
+  for (int i = 0; i < width; i++) {
+    h = (h ^ chars[i].chr) * 16777619u;
+    h = (h ^ (chars[i].attr.attr & ~DATTR_MASK)) * 16777619u;
+    h = (h ^ chars[i].attr.truefg) * 16777619u;
+    h = (h ^ chars[i].attr.truebg) * 16777619u;
+  }
+  return h;
 }
 
+/*
+ * Make sure there's room for a couple of screenfuls of lines, so
+ * that the entries used by one paint don't push each other out.
+ * The number of entries is a power of two, as is the number of
+ * hash buckets, which is the same.
+ */
 static void
-term_bidi_cache_store(struct term* term, int line, termchar *lbefore, termchar *lafter,
-                      bidi_char *wcTo, int width, int size)
-{
-  int i;
-
-  if (!term->pre_bidi_cache || term->bidi_cache_size <= line) {
-    int j = term->bidi_cache_size;
-    term->bidi_cache_size = line + 1;
-    term->pre_bidi_cache = renewn(term->pre_bidi_cache, term->bidi_cache_size);
-    term->post_bidi_cache = renewn(term->post_bidi_cache, term->bidi_cache_size);
-    while (j < term->bidi_cache_size) {
-      term->pre_bidi_cache[j].chars = term->post_bidi_cache[j].chars = null;
-      term->pre_bidi_cache[j].width = term->post_bidi_cache[j].width = -1;
-      term->pre_bidi_cache[j].forward = term->post_bidi_cache[j].forward = null;
-      term->pre_bidi_cache[j].backward = term->post_bidi_cache[j].backward = null;
-      j++;
+bidi_cache_reserve(struct term* term)
+{
+  int size = BIDI_CACHE_MIN;
+  while (size < 2 * term->rows)
+    size *= 2;
+  if (size <= term->bidi_cache_size)
+    return;
+
+  term->bidi_cache = renewn(term->bidi_cache, size);
+  for (int i = term->bidi_cache_size; i < size; i++)
+    term->bidi_cache[i] = (bidi_cache_entry){.last_used = 0};
+  term->bidi_cache_size = size;
+
+  term->bidi_cache_buckets = renewn(term->bidi_cache_buckets, size);
+  for (int i = 0; i < size; i++)
+    term->bidi_cache_buckets[i] = -1;
+  for (int i = 0; i < size; i++) {
+    bidi_cache_entry *e = &term->bidi_cache[i];
+    if (e->last_used) {
+      int *bucket = &term->bidi_cache_buckets[e->hash & (size - 1)];
+      e->next = *bucket;
+      *bucket = i;
     }
   }
+}
 
-  free(term->pre_bidi_cache[line].chars);
-  free(term->post_bidi_cache[line].chars);
-  free(term->post_bidi_cache[line].forward);
-  free(term->post_bidi_cache[line].backward);
-
-  term->pre_bidi_cache[line].width = width;
-  term->pre_bidi_cache[line].chars = newn(termchar, size);
-  term->post_bidi_cache[line].width = width;
-  term->post_bidi_cache[line].chars = newn(termchar, size);
-  term->post_bidi_cache[line].forward = newn(int, width);
-  term->post_bidi_cache[line].backward = newn(int, width);
+static bidi_cache_entry *
+bidi_cache_lookup(struct term* term, uint hash, termchar *chars, int width)
+{
+  int mask = term->bidi_cache_size - 1;
+  for (int i = term->bidi_cache_buckets[hash & mask]; i >= 0;) {
+    bidi_cache_entry *e = &term->bidi_cache[i];
+    if (e->hash == hash && e->width == width) {
+      int j = 0;
+      while (j < width && termchars_equal(e->before + j, chars + j))
+        j++;
+      if (j == width)
+        return e;
+    }
+    i = e->next;
+  }
+  return null;
+}
 
-  memcpy(term->pre_bidi_cache[line].chars, lbefore, size * sizeof(termchar));
-  memcpy(term->post_bidi_cache[line].chars, lafter, size * sizeof(termchar));
-  memset(term->post_bidi_cache[line].forward, 0, width * sizeof (int));
-  memset(term->post_bidi_cache[line].backward, 0, width * sizeof (int));
+/*
+ * Take the least recently used entry out of the cache and file it
+ * under the given hash, with room for a line of the given size.
+ */
+static bidi_cache_entry *
+bidi_cache_recycle(struct term* term, uint hash, int width, int size)
+{
+  int mask = term->bidi_cache_size - 1;
+  int victim = 0;
+  for (int i = 1; i <= mask && term->bidi_cache[victim].last_used; i++) {
+    if (term->bidi_cache[i].last_used < term->bidi_cache[victim].last_used)
+      victim = i;
+  }
+  bidi_cache_entry *e = &term->bidi_cache[victim];
 
-  for (i = 0; i < width; i++) {
-    int p = wcTo[i].index;
+  if (e->last_used) {
+    int *link = &term->bidi_cache_buckets[e->hash & mask];
+    while (*link != victim)
+      link = &term->bidi_cache[*link].next;
+    *link = e->next;
+  }
 
-    assert(0 <= p && p < width);
+  if (e->capacity < size) {
+    e->capacity = size;
+    e->before = renewn(e->before, size);
+    e->after = renewn(e->after, size);
+    e->forward = renewn(e->forward, size);
+    e->backward = renewn(e->backward, size);
+  }
+  e->hash = hash;
+  e->width = width;
+  int *bucket = &term->bidi_cache_buckets[hash & mask];
+  e->next = *bucket;
+  *bucket = victim;
+  return e;
+}
 
-    term->post_bidi_cache[line].backward[i] = p;
-    term->post_bidi_cache[line].forward[p] = i;
+void
+term_bidi_cache_clear(struct term* term)
+{
+  for (int i = 0; i < term->bidi_cache_size; i++) {
+    bidi_cache_entry *e = &term->bidi_cache[i];
+    free(e->before);
+    free(e->after);
+    free(e->forward);
+    free(e->backward);
   }
+  free(term->bidi_cache);
+  free(term->bidi_cache_buckets);
+  term->bidi_cache = null;
+  term->bidi_cache_buckets = null;
+  term->bidi_cache_size = 0;
 }
 
 /*
- * Prepare the bidi information for a screen line. Returns the
- * transformed list of termchars, or null if no transformation at
- * all took place (because bidi is disabled). If return was
- * non-null, auxiliary information such as the forward and reverse
- * mappings of permutation position are available in
- * term.post_bidi_cache[scr_y].*.
+ * Prepare the bidi information for a screen line. Returns the cache
+ * entry holding the transformed list of termchars and the forward and
+ * reverse mappings of permutation position, or null if no
+ * transformation at all took place (because bidi is disabled).
+ * The entry is only valid until the next call.
  */
-termchar *
-term_bidi_line(struct term* term, termline *line, int scr_y)
+bidi_cache_entry *
+term_bidi_line(struct term* term, termline *line)
 {
-  termchar *lchars;
-  int it;
+  trace_scope("term_bidi_line");
+  int width = term->cols;
 
- /* Do Arabic shaping and bidi. */
+  bidi_cache_reserve(term);
 
-  if (!term_bidi_cache_hit(term, scr_y, line->chars, term->cols)) {
-
-    if (term->wcFromTo_size < term->cols) {
-      term->wcFromTo_size = term->cols;
+  uint hash = bidi_hash(line->chars, width);
+  bidi_cache_entry *e = bidi_cache_lookup(term, hash, line->chars, width);
+  if (!e) {
+   /* Do Arabic shaping and bidi. */
+    if (term->wcFromTo_size < width) {
+      term->wcFromTo_size = width;
       term->wcFrom = renewn(term->wcFrom, term->wcFromTo_size);
       term->wcTo = renewn(term->wcTo, term->wcFromTo_size);
     }
 
-    for (it = 0; it < term->cols; it++) {
+    for (int it = 0; it < width; it++) {
       wchar c = line->chars[it].chr;
       term->wcFrom[it].origwc = term->wcFrom[it].wc = c;
       term->wcFrom[it].index = it;
     }
 
-    do_bidi(term->wcFrom, term->cols);
-    do_shape(term->wcFrom, term->wcTo, term->cols);
+    do_bidi(term->wcFrom, width);
+    do_shape(term->wcFrom, term->wcTo, width);
 
-    if (term->ltemp_size < line->size) {
-      term->ltemp_size = line->size;
-      term->ltemp = renewn(term->ltemp, term->ltemp_size);
-    }
+    e = bidi_cache_recycle(term, hash, width, line->size);
+    e->size = line->size;
+    memcpy(e->before, line->chars, line->size * sizeof(termchar));
+    memcpy(e->after, line->chars, line->size * sizeof(termchar));
 
-    memcpy(term->ltemp, line->chars, line->size * sizeof(termchar));
+    for (int it = 0; it < width; it++) {
+      int p = term->wcTo[it].index;
 
-    for (it = 0; it < term->cols; it++) {
-      term->ltemp[it] = line->chars[term->wcTo[it].index];
-      if (term->ltemp[it].cc_next)
-        term->ltemp[it].cc_next -= it - term->wcTo[it].index;
+      assert(0 <= p && p < width);
+
+      e->after[it] = line->chars[p];
+      if (e->after[it].cc_next)
+        e->after[it].cc_next -= it - p;
 
       if (term->wcTo[it].origwc != term->wcTo[it].wc)
-        term->ltemp[it].chr = term->wcTo[it].wc;
-    }
-    term_bidi_cache_store(term, scr_y, line->chars, term->ltemp, term->wcTo,
-                          term->cols, line->size);
+        e->after[it].chr = term->wcTo[it].wc;
 
-    lchars = term->ltemp;
-  }
-  else {
-    lchars = term->post_bidi_cache[scr_y].chars;
+      e->backward[it] = p;
+      e->forward[p] = it;
+    }
   }
 
-  return lchars;
+  e->last_used = ++term->bidi_cache_clock;
+  return e;
 }
@@ -227,6 +227,11 @@ typedef enum {
 static void
 send_mouse_event(struct term* term, mouse_action a, mouse_button b, mod_keys mods, pos p)
 {
+  // Motion reports are superseded by the next one anyway, so they're
+  // the first to go when the child isn't keeping up.
+  if (a == MA_MOVE && child_is_congested(term->child))
+    return;
+
   uint x = p.x + 1, y = p.y + 1;
 
   uint code = b ? b - 1 : 0x3;
@@ -293,8 +298,9 @@ get_selpoint(struct term* term, const pos p)
   * Transform x through the bidi algorithm to find the _logical_
   * click point from the physical one.
   */
-  if (term_bidi_line(term, line, p.y) != null)
-    sp.x = term->post_bidi_cache[p.y].backward[sp.x];
+  bidi_cache_entry *bidi = term_bidi_line(term, line);
+  if (bidi)
+    sp.x = bidi->backward[sp.x];
 
   // Back to previous cell if current one is second half of a wide char
   if (line->chars[sp.x].chr == UCSWIDE)
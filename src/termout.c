@@ -186,6 +186,7 @@ write_char(struct term* term, wchar c, int width)
 {
   if (!c)
     return;
+  term->stats.chars++;
 
   term_cursor *curs = &term->curs;
   termline *line = term->lines[curs->y];
@@ -294,6 +295,7 @@ write_error(struct term* term)
 static bool
 do_ctrl(struct term* term, char c)
 {
+  term->stats.ctrls++;
   switch (c) {
     when '\e':   /* ESC: Escape */
       term->state = ESCAPE;
@@ -331,6 +333,7 @@ do_ctrl(struct term* term, char c)
 static void
 do_esc(struct term* term, uchar c)
 {
+  term->stats.escs++;
   term_cursor *curs = &term->curs;
   term->state = NORMAL;
   switch (CPAIR(term->esc_mod, c)) {
@@ -721,6 +724,8 @@ do_winop(struct term* term)
 static void
 do_csi(struct term* term, uchar c)
 {
+  trace_scope("do_csi");
+  term->stats.csis++;
   term_cursor *curs = &term->curs;
   int arg0 = term->csi_argv[0], arg1 = term->csi_argv[1];
   int arg0_def1 = arg0 ?: 1;  // first arg with default 1
@@ -1004,6 +1009,7 @@ do_colour_osc(struct term* term, uint i)
 static void
 do_cmd(struct term* term)
 {
+  term->stats.cmds++;
   char *s = term->cmd_buf;
   s[term->cmd_len] = 0;
   int size = cs_mbstowcs(NULL, s, 0) + 1;
@@ -1056,6 +1062,31 @@ do_cmd(struct term* term)
       *s = 0;
       child_printf(term->child, "\e]7771;!%s\e\\", term->cmd_buf);
     }
+    when 7772:  // Report or reset performance counters.
+      if (!strcmp(s, "?")) {
+        char buf[768];
+        term_format_stats(term, buf, sizeof buf);
+        child_printf(term->child, "\e]7772;%s\e\\", buf);
+      }
+      else if (!strcmp(s, "0"))
+        term_reset_stats(term);
+    when 7773:  // Report memory use.
+      if (!strcmp(s, "?")) {
+        char buf[256];
+        term_format_memory(term, buf, sizeof buf);
+        child_printf(term->child, "\e]7773;%s\e\\", buf);
+      }
+    when 7774:  // Report or reset keystroke latencies.
+      if (!strcmp(s, "?")) {
+        char buf[256];
+        term_format_latency(term, buf, sizeof buf);
+        child_printf(term->child, "\e]7774;%s\e\\", buf);
+      }
+      else if (!strcmp(s, "0"))
+        term->latency = (term_latency){0};
+    when 7775:  // Paint flashing on or off.
+      if (!strcmp(s, "0") || !strcmp(s, "1"))
+        term_set_paint_flashing(term, *s == '1');
   }
 }
 
@@ -1083,6 +1114,8 @@ term_flush(struct term* term)
   term->inbuf_size = 0;
 }
 
+enum { ECHO_MAX_LEN = 256, ECHO_WINDOW_US = 100000 };
+
 void
 term_write(struct term* term, const char *buf, uint len)
 {
@@ -1101,10 +1134,17 @@ term_write(struct term* term, const char *buf, uint len)
     return;
   }
 
+  trace_scope("term_write");
+  unsigned long long start_us = clock_us();
+  term->stats.bytes += len;
+
   // Reset cursor blinking.
   term->cblinker = 1;
   term_schedule_cblink(term);
 
+  // Input from other terminals may have been processed in between.
+  term_update_cs(term);
+
   uint pos = 0;
   while (pos < len) {
     uchar c = buf[pos++];
@@ -1154,7 +1194,7 @@ term_write(struct term* term, const char *buf, uint len)
           continue;
         }
 
-        switch (cs_mb1towc(&wc, c)) {
+        switch (cs_mb1towc(&term->mb_state, &wc, c)) {
           when 0: // NUL or low surrogate
             if (wc)
               pos--;
@@ -1164,7 +1204,7 @@ term_write(struct term* term, const char *buf, uint len)
               pos--;
             term->high_surrogate = 0;
             term->in_mb_char = false;
-            cs_mb1towc(0, 0); // Clear decoder state
+            cs_mb1towc(&term->mb_state, 0, 0); // Clear decoder state
             continue;
           when -2: // Incomplete character
             term->in_mb_char = true;
@@ -1179,11 +1219,7 @@ term_write(struct term* term, const char *buf, uint len)
 
         if (is_low_surrogate(wc)) {
           if (hwc) {
-            #if HAS_LOCALES
-            int width = wcswidth((wchar[]){hwc, wc}, 2);
-            #else
             int width = xcwidth(combine_surrogates(hwc, wc));
-            #endif
             write_char(term, hwc, width);
             write_char(term, wc, 0);
           }
@@ -1211,11 +1247,7 @@ term_write(struct term* term, const char *buf, uint len)
         }
 
         // Everything else
-        #if HAS_LOCALES
-        int width = wcwidth(wc);
-        #else
         int width = xcwidth(wc);
-        #endif
 
         switch(term->curs.csets[term->curs.g1]) {
           when CSET_LINEDRW:
@@ -1337,9 +1369,25 @@ term_write(struct term* term, const char *buf, uint len)
         }
     }
   }
-  win_schedule_update();
+  // A small write soon after a keystroke is likely its echo, so get it on
+  // screen straight away rather than at the next update tick. Output long
+  // after a keystroke that got no answer has nothing to do with it.
+  bool echo = false;
+  if (term->key_us) {
+    if (!term->key_answered && start_us - term->key_us >= KEY_TIMEOUT_US)
+      term->key_us = 0;
+    else {
+      term->key_answered = true;
+      echo = len <= ECHO_MAX_LEN && start_us - term->key_us < ECHO_WINDOW_US;
+    }
+  }
   if (term->printing) {
     printer_write(term->printbuf, term->printbuf_pos);
     term->printbuf_pos = 0;
   }
+  term->stats.write_us += clock_us() - start_us;
+  if (echo)
+    win_update_now(term);
+  else
+    win_schedule_update();
 }
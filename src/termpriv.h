@@ -6,6 +6,7 @@
  */
 
 #include "term.h"
+#include "trace.h"
 
 #define incpos(p) ((p).x == term->cols ? ((p).x = 0, (p).y++, 1) : ((p).x++, 0))
 #define decpos(p) ((p).x == 0 ? ((p).x = term->cols, (p).y--, 1) : ((p).x--, 0))
@@ -19,6 +20,9 @@
 #define posPlt(p1,p2) ((p1).y <= (p2).y && (p1).x < (p2).x)
 #define posPle(p1,p2) ((p1).y <= (p2).y && (p1).x <= (p2).x)
 
+/* Characters of a paste encoded at a time, see term_paste(). */
+enum { PASTE_CHUNK = 4096 };
+
 void term_print_finish(struct term* term);
 
 void term_schedule_tblink(struct term* term);
@@ -35,6 +39,5 @@ static inline bool
 term_selecting(struct term* term)
 { return term->mouse_state < 0 && term->mouse_state >= MS_SEL_LINE; }
 
-void term_update_cs(struct term* term);
 
 #endif
@@ -0,0 +1,112 @@
+// trace.c (part of FaTTY)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+#include "trace.h"
+
+#ifdef TRACE_EVENTS
+
+#include <pthread.h>
+#include <signal.h>
+
+enum { TRACE_RING_SIZE = 1 << 16 };
+
+typedef struct {
+  const char *name;
+  unsigned long long start, dur;
+} trace_event;
+
+typedef struct trace_ring {
+  struct trace_ring *next;
+  uint tid;
+  uint pos;           // next event to be written
+  bool wrapped;
+  trace_event events[TRACE_RING_SIZE];
+} trace_ring;
+
+static __thread trace_ring *ring;
+static trace_ring *rings;
+static uint ring_count;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static volatile sig_atomic_t dump_requested;
+
+unsigned long long
+trace_now(void)
+{
+  return clock_us();
+}
+
+void
+trace_end(trace_span *span)
+{
+  if (!ring) {
+    ring = newn(trace_ring, 1);
+    if (!ring)
+      return;
+    pthread_mutex_lock(&lock);
+    ring->tid = ++ring_count;
+    ring->next = rings;
+    rings = ring;
+    pthread_mutex_unlock(&lock);
+  }
+  trace_event *e = &ring->events[ring->pos];
+  e->name = span->name;
+  e->start = span->start;
+  e->dur = trace_now() - span->start;
+  if (++ring->pos == TRACE_RING_SIZE) {
+    ring->pos = 0;
+    ring->wrapped = true;
+  }
+}
+
+static void
+dump(void)
+{
+  char *name = getenv("FATTY_TRACE") ?
+               strdup(getenv("FATTY_TRACE")) :
+               asform("/tmp/fatty-trace-%d.json", getpid());
+  FILE *f = fopen(name, "w");
+  free(name);
+  if (!f)
+    return;
+  fputs("{\"traceEvents\":[", f);
+  bool first = true;
+  pthread_mutex_lock(&lock);
+  for (trace_ring *r = rings; r; r = r->next) {
+    uint n = r->wrapped ? TRACE_RING_SIZE : r->pos;
+    uint i = r->wrapped ? r->pos : 0;
+    for (; n--; i = (i + 1) % TRACE_RING_SIZE) {
+      trace_event *e = &r->events[i];
+      fprintf(f, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,"
+                 "\"pid\":%d,\"tid\":%u}",
+              first ? "" : ",", e->name, e->start, e->dur, getpid(), r->tid);
+      first = false;
+    }
+  }
+  pthread_mutex_unlock(&lock);
+  fputs("\n]}\n", f);
+  fclose(f);
+}
+
+void
+trace_dump_if_requested(void)
+{
+  if (dump_requested) {
+    dump_requested = 0;
+    dump();
+  }
+}
+
+static void
+request_dump(int unused(sig))
+{
+  dump_requested = 1;
+}
+
+void
+trace_init(void)
+{
+  signal(SIGUSR1, request_dump);
+  atexit(dump);
+}
+
+#endif
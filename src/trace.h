@@ -0,0 +1,51 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * Scoped trace points for finding out where time goes, compiled in with
+ * TRACE_EVENTS defined (make TRACE_EVENTS=1) and to nothing otherwise.
+ *
+ *   trace_scope("name");
+ *
+ * records the time from there to the end of the enclosing block into a
+ * ring buffer per thread. The rings are written out in Chrome's trace
+ * event format, for chrome://tracing or Perfetto, at exit and whenever
+ * the process gets SIGUSR1. They go to $FATTY_TRACE, or else to
+ * /tmp/fatty-trace-<pid>.json.
+ */
+
+#ifdef TRACE_EVENTS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  const char *name;
+  unsigned long long start;
+} trace_span;
+
+unsigned long long trace_now(void);
+void trace_end(trace_span *);
+void trace_init(void);
+void trace_dump_if_requested(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define trace_concat_(a, b) a##b
+#define trace_concat(a, b) trace_concat_(a, b)
+#define trace_scope(name) \
+  trace_span trace_concat(trace_span_, __LINE__) \
+    __attribute__((cleanup(trace_end))) = {name, trace_now()}
+
+#else
+
+#define trace_scope(name) do {} while (0)
+#define trace_init() do {} while (0)
+#define trace_dump_if_requested() do {} while (0)
+
+#endif
+
+#endif
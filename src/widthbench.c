@@ -0,0 +1,80 @@
+// widthbench.c (part of FaTTY)
+// Licensed under the terms of the GNU General Public License v3 or later.
+
+/*
+ * Times xcwidth() against the C library's wcwidth(), which is what builds
+ * with locale support used before xcwidth.t, over a mix of Latin, CJK,
+ * Arabic and emoji code points. Not part of fatty itself:
+ *
+ *   make widthbench && ./widthbench [rounds]
+ */
+
+#include "charset.h"
+
+#include <locale.h>
+#include <time.h>
+#include <wchar.h>
+
+// Normally from charset.c, which would drag in the rest of fatty.
+bool cs_ambig_wide;
+
+static const xchar ranges[][2] = {
+  {0x0020, 0x007E},    // ASCII
+  {0x00A0, 0x017F},    // Latin-1, Latin Extended-A
+  {0x0300, 0x036F},    // combining diacritics
+  {0x0600, 0x06FF},    // Arabic
+  {0x3040, 0x30FF},    // kana
+  {0x4E00, 0x4FFF},    // CJK ideographs
+  {0xAC00, 0xACFF},    // Hangul
+  {0x1F300, 0x1F64F},  // emoji
+};
+
+static double
+now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+  if (!setlocale(LC_CTYPE, "C.UTF-8"))
+    setlocale(LC_CTYPE, "");
+
+  uint n = 0;
+  for (uint i = 0; i < lengthof(ranges); i++)
+    n += ranges[i][1] - ranges[i][0] + 1;
+  xchar *chars = newn(xchar, n);
+  n = 0;
+  for (uint i = 0; i < lengthof(ranges); i++) {
+    for (xchar c = ranges[i][0]; c <= ranges[i][1]; c++)
+      chars[n++] = c;
+  }
+
+  // Summing the widths keeps the calls from being optimised away.
+  long sum = 0;
+  double start = now();
+  for (int r = 0; r < rounds; r++) {
+    for (uint i = 0; i < n; i++)
+      sum += xcwidth(chars[i]);
+  }
+  double xc_time = now() - start;
+
+  // wcwidth() takes a wchar_t, which is only 16 bits on Cygwin, so the
+  // emoji would come out as something else there.
+  start = now();
+  for (int r = 0; r < rounds; r++) {
+    for (uint i = 0; i < n; i++)
+      sum += wcwidth(chars[i]);
+  }
+  double wc_time = now() - start;
+
+  double calls = (double)rounds * n;
+  printf("%u code points, %d rounds\n", n, rounds);
+  printf("xcwidth  %6.2f ns/char\n", xc_time / calls * 1e9);
+  printf("wcwidth  %6.2f ns/char\n", wc_time / calls * 1e9);
+  return sum == 42;
+}
@@ -7,7 +7,12 @@ void win_reconfig(void);
 
 void win_update(void);
 void win_update_term(struct term* term);
+void win_update_partial(struct term* term);
+void win_update_now(struct term* term);
+void win_flash_run(int x, int y, int len, cattr, int lattr, uint frame);
+void win_flash_info(int cols, uint rows, uint cells);
 void win_schedule_update(void);
+void win_update_if_due(void);
 
 void win_text(int x, int y, wchar_t *text, int len, cattr attr, int lattr);
 void win_update_mouse(void);
@@ -45,8 +50,11 @@ void win_check_glyphs(wchar_t *wcs, unsigned int num);
 void win_open(wstring path);
 void win_copy(const wchar_t *data, unsigned int *attrs, int len);
 void win_paste(void);
+void win_tab_paste_progress(struct term* term);
 
 void win_set_timer(void (*cb)(void*), void* data, unsigned int ticks);
+void win_cancel_timers(void* data);
+void win_schedule_hibernate(void);
 
 void win_show_about(void);
 void win_show_error(wchar_t *);
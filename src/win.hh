@@ -1,12 +1,14 @@
 #pragma once
 
 #include <climits>
+#include <cwchar>
 
 extern "C" {
 // some typedef for mintty header compat
 typedef unsigned int uint;
 typedef unsigned short ushort;
 typedef wchar_t wchar;
+typedef uint xchar;
 typedef unsigned char uchar;
 typedef const char *string;
 typedef const wchar *wstring;
@@ -27,6 +29,7 @@ struct Tab {
         std::wstring titles[16];
         uint titles_i;
         bool attention;
+        int idle_since;   // when the tab was last shown, in ticks
     } info;
 
     Tab();
@@ -491,8 +491,10 @@ paste_unicode_text(HANDLE data)
 {
   wchar *s = GlobalLock(data);
   uint l = wcslen(s);
-  term_paste(win_active_terminal(), s, l);
+  wchar *copy = newn(wchar, l + 1);
+  memcpy(copy, s, (l + 1) * sizeof(wchar));
   GlobalUnlock(data);
+  term_paste(win_active_terminal(), copy, l);
 }
 
 static void
@@ -500,8 +502,8 @@ paste_text(HANDLE data)
 {
   char *cs = GlobalLock(data);
   uint l = MultiByteToWideChar(CP_ACP, 0, cs, -1, 0, 0) - 1;
-  wchar s[l];
-  MultiByteToWideChar(CP_ACP, 0, cs, -1, s, l);
+  wchar *s = newn(wchar, l + 1);
+  MultiByteToWideChar(CP_ACP, 0, cs, -1, s, l + 1);
   GlobalUnlock(data);
   term_paste(win_active_terminal(), s, l);
 }
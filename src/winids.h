@@ -27,5 +27,6 @@
 #define IDM_NEXTTAB     0x00f0
 #define IDM_MOVELEFT    0x0100
 #define IDM_MOVERIGHT   0x0110
+#define IDM_MEMORY      0x0120
 
 #endif
@@ -33,6 +33,13 @@ win_update_menus(void)
     alt_fn ? "&Close\tAlt+F4" : ct_sh ? "&Close\tCtrl+Shift+W" : "&Close"
   );
 
+  term_memory mem;
+  term_get_memory(term, &mem);
+  char mem_text[64];
+  sprintf(mem_text, "Memory: %zu KB, %d scrollback lines",
+          (mem.total + 1023) / 1024, term->sblines);
+  ModifyMenu(menu, IDM_MEMORY, MF_GRAYED, IDM_MEMORY, mem_text);
+
   uint switch_move_enabled = win_tab_count() == 1;
   EnableMenuItem(menu, IDM_PREVTAB, switch_move_enabled);
   EnableMenuItem(menu, IDM_NEXTTAB, switch_move_enabled);
@@ -96,6 +103,7 @@ win_init_menus(void)
   AppendMenu(menu, MF_ENABLED, IDM_OPEN, "Ope&n");
   AppendMenu(menu, MF_ENABLED, IDM_NEWTAB, "New tab\tCtrl+Shift+T");
   AppendMenu(menu, MF_ENABLED, IDM_KILLTAB, "Kill tab");
+  AppendMenu(menu, MF_GRAYED, IDM_MEMORY, "Memory");
   AppendMenu(menu, MF_SEPARATOR, 0, 0);
   AppendMenu(menu, MF_ENABLED, IDM_PREVTAB, "Previous tab\tShift+<-");
   AppendMenu(menu, MF_ENABLED, IDM_NEXTTAB, "Next tab\tShift+->");
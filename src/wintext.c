@@ -7,6 +7,7 @@
 #include "winpriv.h"
 
 #include "minibidi.h"
+#include "trace.h"
 
 #include <winnls.h>
 
@@ -323,6 +324,7 @@ win_zoom_font(int zoom)
 
 static HDC dc;
 static enum { UPDATE_IDLE, UPDATE_BLOCKED, UPDATE_PENDING } update_state;
+static int update_tick;  // when the last update was done
 static bool ime_open;
 
 void
@@ -386,6 +388,7 @@ do_update(void)
   }
 
   update_state = UPDATE_BLOCKED;
+  update_tick = get_tick_count();
 
   dc = GetDC(wnd);
   term_paint(term);
@@ -437,6 +440,51 @@ void win_update_term(struct term* term)
   if (win_active_terminal() == term) win_update();
 }
 
+/*
+ * For when only the cursor or blinking text has changed. Unless a full
+ * update is pending anyway, the screen is otherwise up to date, so just
+ * the affected lines are repainted.
+ */
+void
+win_update_partial(struct term* term)
+{
+  if (win_active_terminal() != term)
+    return;
+  if (update_state == UPDATE_PENDING)
+    return;
+
+  dc = GetDC(wnd);
+  term_paint_partial(term);
+  ReleaseDC(wnd, dc);
+}
+
+/*
+ * Paint straight away, even if there's been an update within the last
+ * tick. Only for keystroke echoes, which are few enough not to need the
+ * throttling.
+ */
+void
+win_update_now(struct term* term)
+{
+  if (win_active_terminal() != term)
+    return;
+  update_state = UPDATE_IDLE;
+  do_update();
+}
+
+/*
+ * Do a pending update if it's due. Timer messages only get generated
+ * when there's nothing else in the message queue, so while other
+ * messages and output keep coming, the update timer alone could leave
+ * the screen stale for a long time.
+ */
+void
+win_update_if_due(void)
+{
+  if (update_state == UPDATE_PENDING && get_tick_count() - update_tick >= 16)
+    do_update();
+}
+
 void
 win_schedule_update(void)
 {
@@ -515,6 +563,7 @@ win_set_ime_open(bool open)
 void
 win_text(int x, int y, wchar *text, int len, cattr attr, int lattr)
 {
+  trace_scope("win_text");
   lattr &= LATTR_MODE;
   int char_width = font_width * (1 + (lattr != LATTR_NORM));
 
@@ -727,6 +776,47 @@ win_text(int x, int y, wchar *text, int len, cattr attr, int lattr)
   }
 }
 
+/*
+ * Paint flashing: outline a run of text that's just been drawn, in one of
+ * a few colours, taken in turn by frame number.
+ */
+void
+win_flash_run(int x, int y, int len, cattr attr, int lattr, uint frame)
+{
+  static const colour tints[] = {
+    RGB(255, 0, 0), RGB(0, 224, 0), RGB(0, 128, 255), RGB(255, 192, 0)
+  };
+  lattr &= LATTR_MODE;
+  int char_width = font_width * (1 + (lattr != LATTR_NORM));
+  x = x * char_width + PADDING;
+  y = y * font_height + PADDING + g_render_tab_height;
+  if (attr.attr & ATTR_WIDE)
+    char_width *= 2;
+
+  HBRUSH brush = CreateSolidBrush(tints[frame % lengthof(tints)]);
+  FrameRect(dc, &(RECT){x, y, x + len * char_width, y + font_height}, brush);
+  DeleteObject(brush);
+}
+
+/*
+ * Paint flashing: show how much the last frame drew in the top right
+ * corner. The text is padded to a fixed width, so it covers what was
+ * there before.
+ */
+void
+win_flash_info(int cols, uint rows, uint cells)
+{
+  char s[40];
+  int len = snprintf(s, sizeof s, " %4u rows %6u cells ", rows, cells);
+  int x = max(0, cols - len) * font_width + PADDING;
+  int y = PADDING + g_render_tab_height;
+  SelectObject(dc, fonts[FONT_NORMAL]);
+  SetTextColor(dc, RGB(255, 255, 255));
+  SetBkColor(dc, RGB(192, 0, 0));
+  SetBkMode(dc, OPAQUE);
+  ExtTextOutA(dc, x, y, 0, 0, s, len, 0);
+}
+
 /* Check availability of characters in the current font.
  * Zeroes each of the characters in the input array that isn't available.
  */
@@ -1,5 +1,5 @@
 #include <windows.h>
-#include <set>
+#include <map>
 #include <tuple>
 #include <vector>
 #include <algorithm>
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "win.hh"
+#include "trace.h"
 
 #include <d2d1.h>
 
@@ -27,9 +28,28 @@ using std::get;
 
 typedef void (*CallbackFn)(void*);
 typedef tuple<CallbackFn, void*> Callback;
-typedef std::set<Callback> CallbackSet;
-
-static CallbackSet callbacks;
+typedef unsigned long long Deadline;
+
+// Timers are kept in a binary heap ordered by deadline, and one Windows
+// timer is set for whichever is due first. Each callback has an entry in
+// an index that tracks its position in the heap, so re-arming a timer
+// just updates its deadline and moves it up or down the heap, without
+// allocating anything. Entries stay in the index while their callback
+// runs, so that one re-arming itself doesn't allocate either. The
+// Windows timer is only reset if it would otherwise go off too late.
+// Going off too early is fine, as it's then simply set again.
+static const size_t not_armed = size_t(-1);
+typedef std::map<Callback, size_t> TimerIndex;  // heap position
+struct Timer {
+    Deadline deadline;
+    TimerIndex::iterator entry;
+};
+static TimerIndex timers;
+static std::vector<Timer> timer_heap;
+static TimerIndex::iterator firing;  // entry whose callback is running
+static bool is_firing;
+static const UINT_PTR timer_id = 1;
+static Deadline timer_armed;  // when the Windows timer goes off, or 0
 static std::vector<Tab> tabs;
 static unsigned int active_tab = 0;
 
@@ -50,8 +70,10 @@ static void init_scale_factors() {
 Tab::Tab() : terminal(new term), chld(new child) {
     memset(terminal.get(), 0, sizeof(struct term));
     memset(chld.get(), 0, sizeof(struct child));
+    terminal->tab = this;
     info.attention = false;
     info.titles_i = 0;
+    info.idle_since = 0;
 }
 Tab::~Tab() {
     if (terminal)
@@ -59,34 +81,162 @@ Tab::~Tab() {
     if (chld)
         child_free(chld.get());
 }
+// Moving tabs around must keep the terminals' back-pointers right.
 Tab::Tab(Tab&& t) {
     info = t.info;
     terminal = std::move(t.terminal);
     chld = std::move(t.chld);
+    if (terminal)
+        terminal->tab = this;
 }
 Tab& Tab::operator=(Tab&& t) {
     std::swap(terminal, t.terminal);
     std::swap(chld, t.chld);
     std::swap(info, t.info);
+    if (terminal)
+        terminal->tab = this;
+    if (t.terminal)
+        t.terminal->tab = &t;
     return *this;
 }
 
 extern "C" {
 
+// GetTickCount() without the wrap-around after 49 days.
+static Deadline timer_now() {
+    static DWORD last;
+    static Deadline high;
+    DWORD now = GetTickCount();
+    if (now < last)
+        high += 1ULL << 32;
+    last = now;
+    return high | now;
+}
+
+static void heap_place(size_t i, const Timer& t) {
+    timer_heap[i] = t;
+    t.entry->second = i;
+}
+
+static void heap_up(size_t i) {
+    Timer t = timer_heap[i];
+    while (i) {
+        size_t parent = (i - 1) / 2;
+        if (timer_heap[parent].deadline <= t.deadline)
+            break;
+        heap_place(i, timer_heap[parent]);
+        i = parent;
+    }
+    heap_place(i, t);
+}
+
+static void heap_down(size_t i) {
+    Timer t = timer_heap[i];
+    size_t n = timer_heap.size();
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= n)
+            break;
+        if (child + 1 < n &&
+            timer_heap[child + 1].deadline < timer_heap[child].deadline)
+            child++;
+        if (t.deadline <= timer_heap[child].deadline)
+            break;
+        heap_place(i, timer_heap[child]);
+        i = child;
+    }
+    heap_place(i, t);
+}
+
+static void heap_remove(size_t i) {
+    timer_heap[i].entry->second = not_armed;
+    Timer last = timer_heap.back();
+    timer_heap.pop_back();
+    if (i < timer_heap.size()) {
+        heap_place(i, last);
+        heap_up(i);
+        heap_down(last.entry->second);
+    }
+}
+
+static void arm_timer() {
+    if (timer_heap.empty())
+        return;
+    Deadline first = timer_heap[0].deadline;
+    if (timer_armed && timer_armed <= first)
+        return;
+    Deadline now = timer_now();
+    SetTimer(wnd, timer_id, first > now ? first - now : 0, NULL);
+    timer_armed = first;
+}
+
+// Cancel all callbacks for the given data, such as when it's freed.
+void win_cancel_timers(void* data) {
+    for (auto entry = timers.begin(); entry != timers.end();) {
+        if (get<1>(entry->first) != data) {
+            ++entry;
+            continue;
+        }
+        if (entry->second != not_armed)
+            heap_remove(entry->second);
+        // The running callback's entry is dropped once it returns.
+        if (is_firing && entry == firing)
+            ++entry;
+        else
+            timers.erase(entry++);
+    }
+}
+
 void win_set_timer(CallbackFn cb, void* data, uint ticks) {
-    auto result = callbacks.insert(std::make_tuple(cb, data));
-    CallbackSet::iterator iter = result.first;
-    SetTimer(wnd, reinterpret_cast<UINT_PTR>(&*iter), ticks, NULL);
+    // Never due immediately, so that a callback re-arming itself waits
+    // for the next timer message.
+    Deadline deadline = timer_now() + std::max(ticks, 1u);
+    auto entry = timers.find(std::make_tuple(cb, data));
+    if (entry == timers.end())
+        entry = timers.emplace(std::make_tuple(cb, data), not_armed).first;
+    size_t pos = entry->second;
+    if (pos == not_armed) {
+        timer_heap.push_back(Timer{deadline, entry});
+        heap_up(timer_heap.size() - 1);
+    }
+    else {
+        Deadline old = timer_heap[pos].deadline;
+        if (old == deadline)
+            return;
+        timer_heap[pos].deadline = deadline;
+        if (deadline < old)
+            heap_up(pos);
+        else
+            heap_down(pos);
+    }
+    arm_timer();
 }
 
 void win_process_timer_message(WPARAM message) {
-    void* pointer = reinterpret_cast<void*>(message);
-    auto callback = *reinterpret_cast<Callback*>(pointer);
-    callbacks.erase(callback);
-    KillTimer(wnd, message);
+    if (message != timer_id)
+        return;
+    KillTimer(wnd, timer_id);
+    timer_armed = 0;
+
+    Deadline now = timer_now();
+    while (!timer_heap.empty() && timer_heap[0].deadline <= now) {
+        firing = timer_heap[0].entry;
+        is_firing = true;
+        heap_remove(0);
+
+        // call the callback
+        Callback callback = firing->first;
+        {
+            trace_scope("timer");
+            get<0>(callback)( get<1>(callback) );
+        }
 
-    // call the callback
-    get<0>(callback)( get<1>(callback) );
+        // Keep the entry only if the callback has re-armed itself.
+        is_firing = false;
+        if (firing->second == not_armed)
+            timers.erase(firing);
+    }
+    arm_timer();
 }
 
 static void invalidate_tabs() {
@@ -107,12 +257,54 @@ static void update_window_state() {
     win_adapt_term_size();
 }
 
+// Background tabs that haven't been shown for HibernateDelay seconds
+// give up their display state; see term_hibernate().
+static bool hibernate_pending;
+
+static void hibernate_cb(void*) {
+    hibernate_pending = false;
+    if (!cfg.hibernate_delay)
+        return;
+    int delay = cfg.hibernate_delay * 1000;
+    int now = get_tick_count();
+    int next = INT_MAX;
+    for (unsigned int i = 0; i < tabs.size(); i++) {
+        Tab& tab = tabs[i];
+        if (i == active_tab || tab.terminal->hibernating)
+            continue;
+        int idle = now - tab.info.idle_since;
+        if (idle >= delay)
+            term_hibernate(tab.terminal.get());
+        if (!tab.terminal->hibernating)
+            next = std::min(next, idle < delay ? delay - idle : delay);
+    }
+    if (next != INT_MAX) {
+        hibernate_pending = true;
+        win_set_timer(hibernate_cb, nullptr, next);
+    }
+}
+
+// For when a background tab has been woken up.
+void win_schedule_hibernate() {
+    if (cfg.hibernate_delay && !hibernate_pending) {
+        hibernate_pending = true;
+        win_set_timer(hibernate_cb, nullptr, cfg.hibernate_delay * 1000);
+    }
+}
+
 static void set_active_tab(unsigned int index) {
+    int now = get_tick_count();
+    if (active_tab < tabs.size())
+        tabs[active_tab].info.idle_since = now;
     active_tab = index;
     Tab* active = &tabs.at(active_tab);
+    active->info.idle_since = now;
+    term_wake(active->terminal.get());
     for (auto& tab : tabs) {
         term_set_focus(tab.terminal.get(), &tab == active);
     }
+    if (cfg.hibernate_delay && tabs.size() > 1)
+        hibernate_cb(nullptr);
     active->info.attention = false;
     update_window_state();
     win_invalidate_all();
@@ -132,9 +324,7 @@ void win_tab_move(int amount) {
 }
 
 static Tab& tab_by_term(struct term* term) {
-    auto match = find_if(tabs.begin(), tabs.end(), [=](Tab& tab) {
-            return tab.terminal.get() == term; });
-    return *match;
+    return *term->tab;
 }
 
 static char* g_home;
@@ -151,7 +341,16 @@ static void newtab(
     tab.chld->cmd = g_cmd;
     tab.chld->home = g_home;
     struct winsize wsz{rows, cols, width, height};
-    child_create(tab.chld.get(), tab.terminal.get(), g_argv, &wsz, cwd);
+    if (!child_create_spare(tab.chld.get(), tab.terminal.get(), &wsz, cwd))
+        child_create(tab.chld.get(), tab.terminal.get(), g_argv, &wsz, cwd);
+    if (cfg.spare_shells) {
+        // Start the next tab's shell once this one has been shown.
+        std::string dir = cwd ? cwd : "";
+        win_callback(200, [=]() {
+            struct winsize size{rows, cols, width, height};
+            child_fill_pool(g_cmd, g_argv, &size, dir.empty() ? nullptr : dir.c_str());
+        });
+    }
     wchar * ws;
     if (title) {
       int size = cs_mbstowcs(NULL, title, 0) + 1;
@@ -182,9 +381,7 @@ void win_tab_init(char* home, char* cmd, char** argv, int width, int height, cha
 }
 void win_tab_create() {
     auto& t = *tabs[active_tab].terminal;
-    std::stringstream cwd_path;
-    cwd_path << "/proc/" << t.child->pid << "/cwd";
-    char* cwd = realpath(cwd_path.str().c_str(), 0);
+    char* cwd = child_get_cwd(t.child);
     newtab(t.rows, t.cols, t.cols * font_width, t.rows * font_height, cwd, nullptr);
     free(cwd);
     set_active_tab(tabs.size() - 1);
@@ -192,20 +389,12 @@ void win_tab_create() {
 }
 
 void win_tab_clean() {
-    bool invalidate = false;
-    for (;;) {
-        auto it = std::find_if(tabs.begin(), tabs.end(), [](Tab& x) {
-                return x.chld->pid == 0; });
-        if (it == tabs.end()) break;
-        invalidate = true;
-        for (;;) {
-          auto cb = std::find_if(callbacks.begin(), callbacks.end(), [&it](Callback x) {
-            return ((term *)(get<1>(x)) == (*it).terminal.get()); });
-          if (cb == callbacks.end()) break;
-          KillTimer(wnd, reinterpret_cast<UINT_PTR>(&*cb));
-          callbacks.erase(cb);
-        }
-        tabs.erase(it);
+    // term_free() cancels the dead terminals' timers.
+    bool invalidate = std::any_of(tabs.begin(), tabs.end(), [](Tab& x) {
+            return x.chld->pid == 0; });
+    if (invalidate) {
+        tabs.erase(std::remove_if(tabs.begin(), tabs.end(), [](Tab& x) {
+                return x.chld->pid == 0; }), tabs.end());
     }
     if (invalidate && tabs.size() > 0) {
         if (active_tab >= tabs.size())
@@ -310,12 +499,24 @@ static HGDIOBJ new_active_tab_font() {
     return CreateFont(tab_font_size(),0,0,0,FW_BOLD,0,0,0,1,0,0,CLEARTYPE_QUALITY,0,0);
 }
 
+// tab title, with the progress of any paste in progress
+static std::wstring tab_title(const Tab& tab) {
+    const std::wstring& title = tab.info.titles[tab.info.titles_i];
+    const term* t = tab.terminal.get();
+    if (!t->paste_buffer || t->paste_len < 1)
+        return title;
+    std::wstringstream ss;
+    ss << title << L" [pasting " << t->paste_pos * 100LL / t->paste_len << L"%]";
+    return ss.str();
+}
+
 // paint a tab to dc (where dc draws to buffer)
 static void paint_tab(HDC dc, int width, int tabheight, const Tab& tab) {
     MoveToEx(dc, 0, tabheight, nullptr);
     LineTo(dc, 0, 0);
     LineTo(dc, width, 0);
-    TextOutW(dc, width/2, (tabheight - tab_font_size()) / 2, tab.info.titles[tab.info.titles_i].data(), tab.info.titles[tab.info.titles_i].size());
+    std::wstring title = tab_title(tab);
+    TextOutW(dc, width/2, (tabheight - tab_font_size()) / 2, title.data(), title.size());
 }
 
 // Wrap GDI object for automatic release
@@ -407,6 +608,17 @@ void win_for_each_term(void (*cb)(struct term* term)) {
         cb(tab.terminal.get());
 }
 
+// Show how far a paste has got, in its tab or, without a tab bar, in
+// the window title.
+void win_tab_paste_progress(struct term* term) {
+    if (tab_bar_visible) {
+        RECT r = {0, 0, win_tab_count() * tab_paint_width + PADDING, tabheight() + PADDING};
+        InvalidateRect(wnd, &r, false);
+    } else if (term == win_active_terminal() && cfg.title_settable) {
+        SetWindowTextW(wnd, tab_title(tab_by_term(term)).c_str());
+    }
+}
+
 void win_tab_mouse_click(int x) {
     unsigned int tab = x / tab_paint_width;
     if (tab >= tabs.size())